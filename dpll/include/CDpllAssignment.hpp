@@ -8,6 +8,7 @@
  */
 
 #include <stack>
+#include <vector>
 
 #include "CException.hpp"
 #include "SFormula.hpp"
@@ -47,6 +48,9 @@ public:
     CDpllAssignment             (CDpllAssignment&&) = default; ///< Rule of 5
     CDpllAssignment& operator = (CDpllAssignment&&) = default; ///< Rule of 5
 
+    /// Resets assignment for the SAT formula reusing allocated memory
+    void reset(const SFormula&);
+
     /// Returns parameters' assignment
     /**
      * @return match for current parameters
@@ -62,6 +66,9 @@ public:
     /// Backtrack to the given state
     void backtrack(const SState&);
 
+    /// Counts occurrences of the new clause's literals in the priorities
+    void add_clause(const std::vector<int>&);
+
     int request() const; ///< Return next literal to assign true to
     void proceed(const int); ///< Assign true to the given literal
 
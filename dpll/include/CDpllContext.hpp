@@ -9,6 +9,12 @@
 
 #include "CDpllFormula.hpp"
 #include "CDpllAssignment.hpp"
+#include "CDpllLookahead.hpp"
+#include "CDpllProof.hpp"
+#include "CGenerator.hpp"
+#include "CLimits.hpp"
+
+#include <memory>
 
 /// @brief
 namespace tinysat {
@@ -27,6 +33,13 @@ public:
     /// State class for the formula
     using TFormulaState = CDpllFormula::SState;
 
+    /// Decision strategy choosing the branching literal
+    enum class EDecision
+    {
+        SORT_HEAP, ///< Top of the assignment's CDpllSortHeap
+        LOOKAHEAD, ///< CDpllLookahead within its node budget, then heap
+    };
+
     /// Represents state of the decision tree
     struct SState
     {
@@ -47,6 +60,9 @@ public:
     CDpllContext             (CDpllContext&&) = default; ///< Rule of 5
     CDpllContext& operator = (CDpllContext&&) = default; ///< Rule of 5
 
+    /// Rebuilds context for the SAT formula reusing allocated memory
+    void reset(const SFormula&);
+
     /// Returns DPLL match
     /**
      * @return assignment's match 
@@ -65,8 +81,66 @@ public:
         return formula_.stats();
     }
 
+    /// Sets decision strategy and lookahead's limits
+    void set_decision(EDecision, 
+            size_t candidates_cnt = CDpllLookahead::DEFAULT_CANDIDATES_CNT,
+            size_t node_budget = CDpllLookahead::DEFAULT_NODE_BUDGET);
+
+    /// Sets params to enumerate the distinct solutions over
+    void set_projection(const std::vector<int>&);
+
+    /// Sets DRAT proof to record the refuted subtrees' clauses to
+    void set_proof(std::shared_ptr<CDpllProof>);
+
+    /// Returns decision strategy
+    /**
+     * @return current decision strategy
+     */
+    [[nodiscard]] EDecision decision() const noexcept
+    {
+        return decision_;
+    }
+
+    /// Returns resource limits checked by the search
+    /**
+     * @return limits to set up and counters
+     */
+    [[nodiscard]] CLimits& limits() noexcept
+    {
+        return limits_;
+    }
+
+    /// Returns result of the last search
+    /**
+     * @return SAT, UNSAT or UNKNOWN if interrupted by the limits
+     * @see next()
+     */
+    [[nodiscard]] EStatus status() const noexcept
+    {
+        return status_;
+    }
+
     [[nodiscard]] bool init(); ///< Find an initial solution
-    [[nodiscard]] bool next(); ///< Find the next solution
+    [[nodiscard]] bool next(); ///< Find the next or resume the search
+
+    /// Lazily enumerates the solutions
+    [[nodiscard]] CGenerator<const SMatch&> models();
+
+    /// Appends clause keeping the search state
+    void add_clause(const std::vector<int>&);
+
+    /// Find a solution with the given literals assumed to be true
+    [[nodiscard]] bool solve(const std::vector<int>&);
+
+    /// Returns failed assumptions of the last unsuccessful solve()
+    /**
+     * @return assumptions that are inconsistent with the formula
+     * @see solve()
+     */
+    [[nodiscard]] const std::vector<int>& core() const noexcept
+    {
+        return core_vec_;
+    }
 
     /// Compares DPLL contexts for the equality
     [[nodiscard]] friend 
@@ -83,11 +157,46 @@ protected:
     /// Propagate the given literal
     [[nodiscard]] bool propagate(int);
 
+    /// Choose the branching literal by the decision strategy
+    [[nodiscard]] int request();
+
+    /// Backtrack to the initial state dropping the decision tree
+    void rewind();
+
+    /// Pop the decision tree's node keeping the path
+    void pop_state();
+
+    /// Record the negated path with the given literal as derived
+    void derive(int);
+
+    /// Record the negated path with the given literal as deleted
+    void forget(int);
+
 private:
+    EDecision decision_ = EDecision::SORT_HEAP;
+
+    // both are built before the formula is moved from
     CDpllAssignment assignment_;
+    CDpllLookahead lookahead_;
+
     CDpllFormula formula_;
 
     std::stack<SState> state_stack_;
+    std::vector<int> core_vec_;
+
+    // projected params are decided before the others
+    std::vector<int> projection_vec_;
+    std::vector<bool> projected_vec_;
+
+    // literals of the current branches below the top, assumptions first
+    std::vector<int> path_vec_;
+    size_t path_base_ = 0u;
+
+    std::shared_ptr<CDpllProof> proof_;
+    std::vector<int> proof_clause_vec_;
+
+    CLimits limits_;
+    EStatus status_ = EStatus::UNKNOWN;
 };
 
 } // namespace tinysat
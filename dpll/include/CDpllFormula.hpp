@@ -12,10 +12,13 @@
 #include <stack>
 #include <unordered_set>
 
+#include "CException.hpp"
 #include "SFormula.hpp"
+#include "SDpllLiteral.hpp"
 
-#include "misc/CBacktrackSkiplist.hpp"
-#include "misc/CBacktrackList.hpp"
+#include "misc/CBacktrackCompactSkiplist.hpp"
+#include "misc/CBacktrackInlineArray.hpp"
+#include "misc/CBacktrackArenaList.hpp"
 
 /// @brief
 namespace tinysat {
@@ -27,12 +30,18 @@ struct SDpllClause;
 class CDpllFormula;
 
 /**
- * Represents clause as list of literals
+ * Represents clause as list of literals.
+ * Short clauses are stored inline by default,
+ * TINYSAT_DPLL_SKIPLIST_CLAUSES selects the sorted skiplist instead.
  */
 struct SDpllClause
 {
 public:
-    using TContainer = CBacktrackSkiplist<int>; ///< literal container's type
+#ifdef TINYSAT_DPLL_SKIPLIST_CLAUSES
+    using TContainer = CBacktrackCompactSkiplist<SDpllLiteral>; ///< literal container's type
+#else // TINYSAT_DPLL_SKIPLIST_CLAUSES
+    using TContainer = CBacktrackInlineArray<SDpllLiteral>; ///< literal container's type
+#endif // TINYSAT_DPLL_SKIPLIST_CLAUSES
     using TIter = TContainer::iterator; ///< container's iterator
     using TNode = TContainer::node_type; ///< container's node type
 
@@ -42,12 +51,14 @@ public:
 
 /**
  * Represents formula as list of literals
- * and holds additional info such as stats and stacks for backtracking
+ * and holds additional info such as stats and stacks for backtracking.
+ * Clauses are stored in the single buffer in the order of their indices,
+ * so the literal log refers to the clause by its index.
  */
 class CDpllFormula
 {
 public:
-    using TContainer = CBacktrackList<SDpllClause>; ///< clause container's type
+    using TContainer = CBacktrackArenaList<SDpllClause>; ///< clause container's type
     using TIter = TContainer::iterator; ///< container's iterator
     using TNode = TContainer::node_type; ///< container's node type
 
@@ -65,19 +76,35 @@ public:
         size_t cls_log_idx; ///< size of the clause log stack
     };
 
+    /// Default ctor
+    CDpllFormula() = default;
+
     /// Copy ctor from the SAT formula
     explicit CDpllFormula(const SFormula&);
     /// Move ctor from the SAT formula
     explicit CDpllFormula(SFormula&&);
 
-    CDpllFormula             (const CDpllFormula&) = default; ///< Rule of 5
-    CDpllFormula& operator = (const CDpllFormula&) = default; ///< Rule of 5
+    // logs hold the nodes referring to the clauses' containers
+    CDpllFormula             (const CDpllFormula&) = delete; ///< Rule of 5
+    CDpllFormula& operator = (const CDpllFormula&) = delete; ///< Rule of 5
     CDpllFormula             (CDpllFormula&&) = default; ///< Rule of 5
     CDpllFormula& operator = (CDpllFormula&&) = default; ///< Rule of 5
 
+    /// Rebuilds formula from the SAT formula reusing allocated memory
+    void reset(const SFormula&);
+
     /// Returns current statistics
     [[nodiscard]] const SStats& stats() const noexcept;
 
+    /// Returns remaining clauses
+    /**
+     * @return clauses that aren't satisfied yet
+     */
+    [[nodiscard]] const TContainer& clauses() const noexcept
+    {
+        return clauses_;
+    }
+
     /// Returns current state
     [[nodiscard]] SState get_state() const noexcept;
 
@@ -87,6 +114,9 @@ public:
     /// Assign true to the given literal
     bool proceed(const int);
 
+    /// Appends clause to the formula in the initial state
+    void add_clause(const std::vector<int>&);
+
 protected:
     /// Represents single extracted literal
     /**
@@ -104,10 +134,13 @@ protected:
      */
     using TClsLogEntry = TNode;
 
+    /// Encodes clause's literals for the container
+    [[nodiscard]] static std::vector<SDpllLiteral> 
+    encode(const std::vector<int>&);
+
 private:
     SStats stats_;
 
-    std::vector<TIter> iter_map_;
     TContainer clauses_;
 
     std::stack<SLitLogEntry> lit_log_stk_;
@@ -0,0 +1,104 @@
+#ifndef TINYSAT_DPLL_CDPLLLOOKAHEAD_HPP_
+#define TINYSAT_DPLL_CDPLLLOOKAHEAD_HPP_
+
+/**
+ * @file CDpllLookahead.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <vector>
+
+#include "SFormula.hpp"
+#include "CDpllFormula.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Lookahead branching heuristic
+class CDpllLookahead;
+
+/**
+ * Chooses the branching literal in the march style.
+ * Candidates are preselected by the diff score of the current formula,
+ * every candidate's literal is propagated tentatively and the variable
+ * with the best balanced reduction of the formula is chosen.
+ * Failed literal makes its negation the branching literal,
+ * so the failing branch is refuted right after the propagation.
+ *
+ * Lookahead is made at most at the node budget decision nodes,
+ * request() returns 0 after that and the caller falls back.
+ */
+class CDpllLookahead
+{
+public:
+    /// Count of the candidates propagated at each node
+    static constexpr size_t DEFAULT_CANDIDATES_CNT = 8u;
+
+    /// Count of the decision nodes with the lookahead
+    static constexpr size_t DEFAULT_NODE_BUDGET = 1u << 16u;
+
+    /// Equals W, where the mix of reductions is W*pos*neg + pos + neg
+    static constexpr size_t MIX_FACTOR = 1024u;
+
+    CDpllLookahead() = default; ///< Default Ctor
+
+    /// Ctor from existing SAT formula
+    explicit CDpllLookahead(const SFormula&, 
+                            size_t = DEFAULT_CANDIDATES_CNT,
+                            size_t = DEFAULT_NODE_BUDGET);
+
+    CDpllLookahead             (const CDpllLookahead&) = default; ///< Rule of 5
+    CDpllLookahead& operator = (const CDpllLookahead&) = default; ///< Rule of 5
+    CDpllLookahead             (CDpllLookahead&&) = default; ///< Rule of 5
+    CDpllLookahead& operator = (CDpllLookahead&&) = default; ///< Rule of 5
+
+    /// Rebuilds heuristic for the SAT formula restoring the node budget
+    void reset(const SFormula&);
+
+    /// Sets limits of the lookahead
+    void set_limits(size_t candidates_cnt, size_t node_budget) noexcept;
+
+    /// Returns count of the decision nodes left
+    /**
+     * @return remaining node budget
+     */
+    [[nodiscard]] size_t budget() const noexcept
+    {
+        return budget_;
+    }
+
+    /// Returns literal to branch on or 0 if nothing to look ahead
+    int request(CDpllFormula&);
+
+protected:
+    /// Fills candidates with the best diff score params
+    void preselect(const CDpllFormula&);
+
+    /// Propagates literal tentatively and restores the formula
+    [[nodiscard]] bool probe(CDpllFormula&, int, size_t&);
+
+    /// Converts literal to its internal index
+    /**
+     * @param[in] lit literal
+     * @return index of lit
+     */
+    [[nodiscard]] constexpr inline 
+    size_t lit2idx(const int lit) const noexcept
+    {
+        return SDpllLiteral::from_int(lit).idx();
+    }
+
+private:
+    size_t params_cnt_ = 0u;
+    size_t candidates_cnt_ = DEFAULT_CANDIDATES_CNT;
+    size_t node_budget_ = DEFAULT_NODE_BUDGET;
+    size_t budget_ = DEFAULT_NODE_BUDGET;
+
+    std::vector<double> score_vec_;
+    std::vector<int> candidate_vec_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_DPLL_CDPLLLOOKAHEAD_HPP_
@@ -0,0 +1,110 @@
+#ifndef TINYSAT_DPLL_CDPLLPROOF_HPP_
+#define TINYSAT_DPLL_CDPLLPROOF_HPP_
+
+/**
+ * @file CDpllProof.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+/// @brief
+namespace tinysat {
+
+/// DRAT proof writer
+class CDpllProof;
+
+/**
+ * Serializes added and deleted clauses in the DRAT format.
+ * Clauses are encoded into the current buffer, the full buffer
+ * is handed to the writer thread, so the stream's output overlaps
+ * with the search. At most MAX_PENDING buffers wait for the output,
+ * the search blocks until the writer catches up after that.
+ *
+ * Binary format is the drat-trim's one: 'a' or 'd' byte followed by
+ * the literals 2*|lit| + (lit < 0) as the 7-bit varints and zero.
+ */
+class CDpllProof
+{
+public:
+    /// Output format
+    enum class EFormat
+    {
+        TEXT, ///< DIMACS-like lines, deletions are prefixed with "d"
+        BINARY, ///< Binary DRAT
+    };
+
+    /// Default size of the buffer handed to the writer thread
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1u << 16u;
+
+    /// Count of the full buffers waiting for the output
+    static constexpr size_t MAX_PENDING = 4u;
+
+    /// Ctor from the output stream outliving the proof
+    explicit CDpllProof(std::ostream&, EFormat = EFormat::BINARY,
+                        size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+    CDpllProof             (const CDpllProof&) = delete; ///< Rule of 5
+    CDpllProof& operator = (const CDpllProof&) = delete; ///< Rule of 5
+    CDpllProof             (CDpllProof&&) = delete; ///< Rule of 5
+    CDpllProof& operator = (CDpllProof&&) = delete; ///< Rule of 5
+
+    /// Flushes buffers and joins the writer
+    ~CDpllProof();
+
+    /// Returns output format
+    /**
+     * @return output format
+     */
+    [[nodiscard]] EFormat format() const noexcept
+    {
+        return format_;
+    }
+
+    /// Records the derived clause
+    void add(const std::vector<int>&);
+
+    /// Records the deleted clause
+    void remove(const std::vector<int>&);
+
+    /// Writes all the recorded clauses and flushes the stream
+    void flush();
+
+protected:
+    /// Encodes the clause with the given prefix
+    void encode(char prefix, const std::vector<int>&);
+
+    /// Hands the current buffer to the writer
+    void submit();
+
+    /// Writer's main loop
+    void work();
+
+private:
+    std::ostream& stream_;
+    EFormat format_;
+    size_t buffer_size_;
+
+    std::vector<char> buffer_;
+
+    std::mutex mutex_;
+    std::condition_variable pending_cv_;
+    std::condition_variable done_cv_;
+
+    std::deque<std::vector<char>> pending_deq_;
+    std::vector<std::vector<char>> free_vec_;
+    bool writing_ = false;
+    bool stop_ = false;
+
+    std::thread writer_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_DPLL_CDPLLPROOF_HPP_
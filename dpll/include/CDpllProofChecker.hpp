@@ -0,0 +1,84 @@
+#ifndef TINYSAT_DPLL_CDPLLPROOFCHECKER_HPP_
+#define TINYSAT_DPLL_CDPLLPROOFCHECKER_HPP_
+
+/**
+ * @file CDpllProofChecker.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <istream>
+#include <map>
+#include <vector>
+
+#include "SFormula.hpp"
+#include "SMatch.hpp"
+#include "CDpllProof.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Forward checker of the DRUP proofs
+class CDpllProofChecker;
+
+/**
+ * Replays the proof over the formula checking every added clause
+ * to be RUP, i.e. unit propagation of its negation reaches a conflict.
+ * RAT additions aren't checked, as CDpllContext derives RUP clauses only.
+ * Proof is accepted if the empty clause is derived.
+ *
+ * Propagation rescans all the clauses until the fixpoint,
+ * so the checker is meant for the tests on small formulas.
+ */
+class CDpllProofChecker
+{
+public:
+    using EFormat = CDpllProof::EFormat; ///< Proof format
+
+    /// Ctor from the formula the proof refutes
+    explicit CDpllProofChecker(const SFormula&);
+
+    CDpllProofChecker             (const CDpllProofChecker&) = default; ///< Rule of 5
+    CDpllProofChecker& operator = (const CDpllProofChecker&) = default; ///< Rule of 5
+    CDpllProofChecker             (CDpllProofChecker&&) = default; ///< Rule of 5
+    CDpllProofChecker& operator = (CDpllProofChecker&&) = default; ///< Rule of 5
+
+    /// Checks the proof read from the stream
+    [[nodiscard]] bool check(std::istream&, EFormat = EFormat::BINARY);
+
+    /// Returns count of the checked additions
+    /**
+     * @return count of the added clauses
+     */
+    [[nodiscard]] size_t lemmas() const noexcept
+    {
+        return lemma_cnt_;
+    }
+
+protected:
+    /// Reads the next clause, returns false at the end of stream
+    [[nodiscard]] bool read(std::istream&, EFormat,
+                            char& prefix, std::vector<int>& clause) const;
+
+    /// Checks clause to be RUP with respect to the alive clauses
+    [[nodiscard]] bool is_rup(const std::vector<int>&);
+
+    /// Appends clause to the database
+    void insert(std::vector<int>);
+
+private:
+    size_t params_cnt_ = 0u;
+    size_t lemma_cnt_ = 0u;
+
+    std::vector<std::vector<int>> clause_vec_;
+    std::vector<bool> alive_vec_;
+
+    // alive clauses' indices by the sorted literals for the deletions
+    std::map<std::vector<int>, std::vector<size_t>> index_map_;
+
+    SMatch match_; // scratch for the propagation
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_DPLL_CDPLLPROOFCHECKER_HPP_
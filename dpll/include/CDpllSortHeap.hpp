@@ -7,7 +7,10 @@
  * @date 2020
  */
 
+#include <cmath>
+
 #include "SFormula.hpp"
+#include "SDpllLiteral.hpp"
 
 /// @brief
 namespace tinysat {
@@ -35,6 +38,9 @@ public:
     CDpllSortHeap             (CDpllSortHeap&&) = default; ///< Rule of 5
     CDpllSortHeap& operator = (CDpllSortHeap&&) = default; ///< Rule of 5
 
+    /// Rebuilds heap for the SAT formula reusing allocated memory
+    void reset(const SFormula&);
+
     /// Returns active literal's count
     /**
      * @return active literal's count
@@ -60,6 +66,7 @@ public:
 
     double get_prior(const int) const; ///< Returns literal priority
     void dec_prior(const int); ///< Decreases conflict literal priority
+    void inc_prior(const int); ///< Increases priority by an occurrence
 
     /// Provides simple error checking
     [[nodiscard]] bool ok() const noexcept;
@@ -80,36 +87,21 @@ protected:
     /**
      * @param[in] lit literal
      * @return index of lit
-     * @see idx2lit()
-     */
-    [[nodiscard]] constexpr inline 
-    size_t lit2idx(const int lit) const noexcept
-    {
-        return (lit < 0 ? 
-                static_cast<size_t>(lit_cnt_/2u + (-lit - 1)) : 
-                static_cast<size_t>(lit - 1));
-    }
-
-    /// Converts internal index to the corresponding literal
-    /**
-     * @param[in] idx index
-     * @return literal with index idx
-     * @see lit2idx()
+     * @see SDpllLiteral
      */
-    [[nodiscard]] constexpr inline 
-    int idx2lit(const size_t idx) const noexcept
+    [[nodiscard]] static constexpr inline 
+    size_t lit2idx(const int lit) noexcept
     {
-        return (idx < lit_cnt_/2u ? 
-                +static_cast<int>(idx + 1u) : 
-                -static_cast<int>(idx + 1u - lit_cnt_/2u));
+        return SDpllLiteral::from_int(lit).idx();
     }
 
 private:
     size_t lit_cnt_ = 0u;
     size_t size_ = 0u;
     double prior_sum_ = 0.0;
+    double occ_prior_ = 1.0;
     std::vector<double> prior_vec_;
-    std::vector<int> heap_vec_;
+    std::vector<SDpllLiteral> heap_vec_;
     std::vector<size_t> heap_map_;
 };
 
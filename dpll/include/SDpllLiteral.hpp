@@ -0,0 +1,105 @@
+#ifndef TINYSAT_DPLL_SDPLLLITERAL_HPP_
+#define TINYSAT_DPLL_SDPLLLITERAL_HPP_
+
+/**
+ * @file SDpllLiteral.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <compare>
+
+#include "SMatch.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Literal encoded as an unsigned index
+struct SDpllLiteral;
+
+/**
+ * Holds 2*(param - 1) + (lit < 0), so the literals of the param
+ * are adjacent, negation flips the low bit and the code itself
+ * indexes per-literal arrays, all without branches on the sign.
+ * Signed int literals are converted only at the containers' interfaces.
+ */
+struct SDpllLiteral
+{
+public:
+    using TCode = uint32_t; ///< Code's type
+
+    /// Converts signed literal
+    /**
+     * @param [in] lit nonzero signed literal
+     * @return encoded literal
+     * @see to_int()
+     */
+    [[nodiscard]] static constexpr SDpllLiteral from_int(int lit) noexcept
+    {
+        const auto sign = static_cast<TCode>(lit) >> 31u;
+        const auto param = (static_cast<TCode>(lit) ^ (0u - sign)) + sign;
+
+        return SDpllLiteral { .code = ((param - 1u) << 1u) | sign };
+    }
+
+    /// Converts back to the signed literal
+    /**
+     * @return signed literal
+     * @see from_int()
+     */
+    [[nodiscard]] constexpr int to_int() const noexcept
+    {
+        const auto param = static_cast<int>(code >> 1u) + 1;
+        const auto sign = -static_cast<int>(code & 1u);
+
+        return (param ^ sign) - sign;
+    }
+
+    /// Returns zero-based param's index
+    /**
+     * @return index of the param
+     */
+    [[nodiscard]] constexpr size_t param() const noexcept
+    {
+        return code >> 1u;
+    }
+
+    /// Returns index for the per-literal arrays
+    /**
+     * @return code as index
+     */
+    [[nodiscard]] constexpr size_t idx() const noexcept
+    {
+        return code;
+    }
+
+    /// Returns value of the param making the literal true
+    /**
+     * @return TRUE for the positive literal, FALSE for the negative one
+     */
+    [[nodiscard]] constexpr SMatch::EValue value() const noexcept
+    {
+        return static_cast<SMatch::EValue>((code & 1u) ^ 1u);
+    }
+
+    /// Negation
+    /**
+     * @return literal of the same param with the opposite sign
+     */
+    [[nodiscard]] constexpr SDpllLiteral operator ~ () const noexcept
+    {
+        return SDpllLiteral { .code = code ^ 1u };
+    }
+
+    /// Comparison by the codes
+    [[nodiscard]] friend constexpr
+    auto operator <=> (const SDpllLiteral&, const SDpllLiteral&) = default;
+
+    TCode code; ///< 2*(param - 1) + sign
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_DPLL_SDPLLLITERAL_HPP_
@@ -0,0 +1,704 @@
+#ifndef TINYSAT_CBACKTRACKARENALIST_HPP_
+#define TINYSAT_CBACKTRACKARENALIST_HPP_
+
+/**
+ * @file CBacktrackArenaList.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <iterator>
+#include <vector>
+
+/// @brief
+namespace tinysat {
+
+//----------------------------------------
+// CBacktrackArenaList<TData> class
+//----------------------------------------
+
+/// List able to extract/restore its nodes stored in a single buffer
+/**
+ * Implements the CBacktrackList interface with all the entries
+ * in one vector linked by 32-bit indices in the insertion order.
+ * Extracted entry stays in the buffer keeping its links,
+ * so extract() and restore() only relink its neighbours,
+ * and destruction is a single deallocation without recursion.
+ * Iterators and nodes refer to the entries by indices,
+ * so they stay valid after push_back() reallocates the buffer.
+ */
+template<typename TData>
+class CBacktrackArenaList
+{
+public:
+    class CNode; ///< Node holding extracted value
+    class CIterator; ///< Bidirectional iterator
+    class CConstIterator; ///< Constant bidirectional iterator
+
+    using data_type = TData; ///< Type of elements
+    using node_type = CNode; ///< Type of single node
+    using iterator = CIterator; ///< Alias for iterator
+    using const_iterator = CConstIterator; ///< Alias for constant iterator
+
+    using TIndex = uint32_t; ///< Type of the links
+
+    /// Null index representation
+    static constexpr TIndex NULL_IDX = static_cast<TIndex>(-1);
+
+    /// Entry holding value and 2 links
+    struct SEntry
+    {
+        TData data; ///< Value
+        TIndex next; ///< Successor's index
+        TIndex prev; ///< Predecessor's index
+    };
+
+    /// Default ctor
+    CBacktrackArenaList() = default;
+
+    /// Ctor from range
+    template<typename TIter>
+    CBacktrackArenaList(TIter&&, TIter&&);
+
+    /// Rule of 5
+    CBacktrackArenaList             (const CBacktrackArenaList&) = default;
+    /// Rule of 5
+    CBacktrackArenaList& operator = (const CBacktrackArenaList&) = default;
+
+    /// Rule of 5
+    CBacktrackArenaList             (CBacktrackArenaList&&) = default;
+    /// Rule of 5
+    CBacktrackArenaList& operator = (CBacktrackArenaList&&) = default;
+
+    /// Returns current elements' count
+    /**
+     * @return size of list
+     * @see empty()
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// Returns true iff list is empty
+    /**
+     * @return true iff list is empty
+     * @see size()
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the front element
+     * @see CIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CIterator begin()
+    {
+        return CIterator(this, head_);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const_iterator pointing to the front element
+     * @see CConstIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CConstIterator begin() const
+    {
+        return CConstIterator(this, head_);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const_iterator pointing to the front element
+     * @see CConstIterator begin() end() cend()
+     */
+    [[nodiscard]] CConstIterator cbegin() const
+    {
+        return begin();
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the past-to-end element
+     * @see CIterator begin() cbegin() end() cend()
+     */
+    [[nodiscard]] CIterator end()
+    {
+        return CIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const_iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() cend()
+     */
+    [[nodiscard]] CConstIterator end() const
+    {
+        return CConstIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const_iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() end()
+     */
+    [[nodiscard]] CConstIterator cend() const
+    {
+        return end();
+    }
+
+    /// Accesses value by its insertion index, extracted or not
+    /**
+     * @param [in] idx count of the values pushed before
+     * @return corresponding value
+     */
+    [[nodiscard]] TData& at(const size_t idx)
+    {
+        return entry_vec_[idx].data;
+    }
+
+    /// Accesses value by its insertion index, extracted or not
+    /**
+     * @param [in] idx count of the values pushed before
+     * @return corresponding value
+     */
+    [[nodiscard]] const TData& at(const size_t idx) const
+    {
+        return entry_vec_[idx].data;
+    }
+
+    /// Reserves buffer for the given count of entries
+    /**
+     * @param [in] capacity count of entries
+     */
+    void reserve(const size_t capacity)
+    {
+        entry_vec_.reserve(capacity);
+    }
+
+    /// Removes all the entries keeping the buffer
+    void clear() noexcept
+    {
+        entry_vec_.clear();
+        size_ = 0u;
+        head_ = tail_ = NULL_IDX;
+    }
+
+    /// Extracts corresponding entry
+    CNode extract(const CIterator);
+    /// Restore corresponding entry
+    CIterator restore(CNode&&);
+
+    /// Pushes back new entry holding copied given value
+    CIterator push_back(const TData&);
+    /// Pushes back new entry holding moved given value
+    CIterator push_back(TData&&);
+
+protected:
+    /// Links new back entry
+    CIterator link_back();
+
+private:
+    size_t size_ = 0u;
+    TIndex head_ = NULL_IDX;
+    TIndex tail_ = NULL_IDX;
+
+    std::vector<SEntry> entry_vec_;
+};
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CNode class
+//----------------------------------------
+
+/// Extracted entry's handle class
+/**
+ * Holds index of the extracted SEntry
+ * @see SEntry
+ */
+template<typename TData>
+class CBacktrackArenaList<TData>::CNode
+{
+public:
+    friend class CBacktrackArenaList<TData>;
+
+    /// Ctor from pointer to parent list and index
+    CNode(CBacktrackArenaList<TData>*, const TIndex);
+
+    CNode             (const CNode&) = delete; ///< Rule of 5
+    CNode& operator = (const CNode&) = delete; ///< Rule of 5
+
+    CNode             (CNode&&) = default; ///< Rule of 5
+    CNode& operator = (CNode&&) = default; ///< Rule of 5
+
+    /// Access corresponding data
+    [[nodiscard]] TData& get() const;
+
+private:
+    CBacktrackArenaList<TData>* list_ptr_;
+    TIndex entry_idx_;
+};
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CIterator class
+//----------------------------------------
+
+/// Iterator class
+/**
+ * Implements bidirectional iterator for the CBacktrackArenaList template
+ * @see CConstIterator
+ */
+template<typename TData>
+class CBacktrackArenaList<TData>::CIterator
+{
+public:
+    friend class CBacktrackArenaList<TData>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits
+    using value_type = TData; ///< Traits
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits
+
+    /// Default ctor
+    CIterator() = default;
+
+    /// Ctor from list pointer and entry index
+    CIterator(CBacktrackArenaList<TData>*, const TIndex);
+
+    CIterator             (const CIterator&) = default; ///< Rule of 5
+    CIterator& operator = (const CIterator&) = default; ///< Rule of 5
+    CIterator             (CIterator&&) = default; ///< Rule of 5
+    CIterator& operator = (CIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] TData* operator -> () const; ///< InputIt interface
+
+    CIterator& operator ++ (); ///< InputIt interface
+    CIterator& operator -- (); ///< BidirIt interface
+
+    const CIterator operator ++ (int); ///< InputIt interface
+    const CIterator operator -- (int); ///< BidirIt interface
+
+    /// implicit add-constness
+    operator CBacktrackArenaList<TData>::CConstIterator () const;
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CIterator& lhs, const CIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.entry_idx_ == rhs.entry_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CIterator& lhs, const CIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    CBacktrackArenaList<TData>* list_ptr_ = nullptr;
+    TIndex entry_idx_ = CBacktrackArenaList<TData>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CConstIterator class
+//----------------------------------------
+
+/// ConstIterator class
+/**
+ * Implements constant bidirectional iterator
+ * for the CBacktrackArenaList template
+ * @see CIterator
+ */
+template<typename TData>
+class CBacktrackArenaList<TData>::CConstIterator
+{
+public:
+    friend class CBacktrackArenaList<TData>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits
+    using value_type = const TData; ///< Traits
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits
+
+    /// Default ctor
+    CConstIterator() = default;
+
+    /// Ctor from list pointer and entry index
+    CConstIterator(const CBacktrackArenaList<TData>*, const TIndex);
+
+    CConstIterator             (const CConstIterator&) = default; ///< Rule of 5
+    CConstIterator& operator = (const CConstIterator&) = default; ///< Rule of 5
+    CConstIterator             (CConstIterator&&) = default; ///< Rule of 5
+    CConstIterator& operator = (CConstIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] const TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] const TData* operator -> () const; ///< InputIt interface
+
+    CConstIterator& operator ++ (); ///< InputIt interface
+    CConstIterator& operator -- (); ///< BidirIt interface
+
+    const CConstIterator operator ++ (int); ///< InputIt interface
+    const CConstIterator operator -- (int); ///< BidirIt interface
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.entry_idx_ == rhs.entry_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const CBacktrackArenaList<TData>* list_ptr_ = nullptr;
+    TIndex entry_idx_ = CBacktrackArenaList<TData>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CNode methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent list
+ * @param [in] entry_idx index of the extracted entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CNode::
+CNode(CBacktrackArenaList<TData>* list_ptr, const TIndex entry_idx):
+    list_ptr_{ list_ptr },
+    entry_idx_{ entry_idx }
+{}
+
+/**
+ * @return reference to the extracted value
+ */
+template<typename TData>
+TData&
+CBacktrackArenaList<TData>::CNode::
+get() const
+{
+    return list_ptr_->entry_vec_[entry_idx_].data;
+}
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to parent list
+ * @param [in] entry_idx index of corresponding entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator::
+CIterator(CBacktrackArenaList<TData>* list_ptr, const TIndex entry_idx):
+    list_ptr_{ list_ptr },
+    entry_idx_{ entry_idx }
+{}
+
+/**
+ * @return reference to the corresponding entry's data
+ */
+template<typename TData>
+TData&
+CBacktrackArenaList<TData>::CIterator::
+operator * () const
+{
+    return list_ptr_->entry_vec_[entry_idx_].data;
+}
+
+/**
+ * @return pointer to the corresponding entry's data
+ */
+template<typename TData>
+TData*
+CBacktrackArenaList<TData>::CIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return reference to *this
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator&
+CBacktrackArenaList<TData>::CIterator::
+operator ++ ()
+{
+    entry_idx_ = list_ptr_->entry_vec_[entry_idx_].next;
+    return *this;
+}
+
+/**
+ * @return reference to *this
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator&
+CBacktrackArenaList<TData>::CIterator::
+operator -- ()
+{
+    entry_idx_ = (entry_idx_ == NULL_IDX ? list_ptr_->tail_ :
+                  list_ptr_->entry_vec_[entry_idx_].prev);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::CIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::CIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+/**
+ * @return corresponding CConstIterator
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator::
+operator CBacktrackArenaList<TData>::CConstIterator () const
+{
+    return CConstIterator(list_ptr_, entry_idx_);
+}
+
+//----------------------------------------
+// CBacktrackArenaList<TData>::CConstIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to parent list
+ * @param [in] entry_idx index of corresponding entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CConstIterator::
+CConstIterator(const CBacktrackArenaList<TData>* list_ptr,
+               const TIndex entry_idx):
+    list_ptr_{ list_ptr },
+    entry_idx_{ entry_idx }
+{}
+
+/**
+ * @return reference to the corresponding entry's data
+ */
+template<typename TData>
+const TData&
+CBacktrackArenaList<TData>::CConstIterator::
+operator * () const
+{
+    return list_ptr_->entry_vec_[entry_idx_].data;
+}
+
+/**
+ * @return pointer to the corresponding entry's data
+ */
+template<typename TData>
+const TData*
+CBacktrackArenaList<TData>::CConstIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return reference to *this
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CConstIterator&
+CBacktrackArenaList<TData>::CConstIterator::
+operator ++ ()
+{
+    entry_idx_ = list_ptr_->entry_vec_[entry_idx_].next;
+    return *this;
+}
+
+/**
+ * @return reference to *this
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CConstIterator&
+CBacktrackArenaList<TData>::CConstIterator::
+operator -- ()
+{
+    entry_idx_ = (entry_idx_ == NULL_IDX ? list_ptr_->tail_ :
+                  list_ptr_->entry_vec_[entry_idx_].prev);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const CBacktrackArenaList<TData>::CConstIterator
+CBacktrackArenaList<TData>::CConstIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const CBacktrackArenaList<TData>::CConstIterator
+CBacktrackArenaList<TData>::CConstIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+//----------------------------------------
+// CBacktrackArenaList<TData> methods
+//----------------------------------------
+
+/**
+ * @param [in] begin_it range begin iterator
+ * @param [in] end_it range end iterator
+ */
+template<typename TData>
+template<typename TIter>
+CBacktrackArenaList<TData>::
+CBacktrackArenaList(TIter&& begin_it, TIter&& end_it)
+{
+    for (auto it = std::forward<TIter>(begin_it); it != end_it; ++it)
+        push_back(*it);
+}
+
+/**
+ * @param [in] iter iterator to the entry
+ * @return node referring to the entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CNode
+CBacktrackArenaList<TData>::extract(const CIterator iter)
+{
+    const TIndex idx = iter.entry_idx_;
+    const auto& entry = entry_vec_[idx];
+
+    if (entry.next != NULL_IDX) entry_vec_[entry.next].prev = entry.prev;
+    else                        tail_ = entry.prev;
+
+    if (entry.prev != NULL_IDX) entry_vec_[entry.prev].next = entry.next;
+    else                        head_ = entry.next;
+
+    --size_;
+
+    return CNode(this, idx);
+}
+
+/**
+ * @param [in] node node referring to the entry
+ * @return iterator to the entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::restore(CNode&& node)
+{
+    const TIndex idx = std::move(node).entry_idx_;
+    const auto& entry = entry_vec_[idx];
+
+    if (entry.prev != NULL_IDX) entry_vec_[entry.prev].next = idx;
+    else                        head_ = idx;
+
+    if (entry.next != NULL_IDX) entry_vec_[entry.next].prev = idx;
+    else                        tail_ = idx;
+
+    ++size_;
+
+    return CIterator(this, idx);
+}
+
+/**
+ * @param [in] data data copied to the new entry that is pushed back
+ * @return iterator to the new entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::
+push_back(const TData& data)
+{
+    entry_vec_.push_back(SEntry {
+            .data = data, .next = NULL_IDX, .prev = tail_
+        });
+
+    return link_back();
+}
+
+/**
+ * @param [in] data data moved to the new entry that is pushed back
+ * @return iterator to the new entry
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::
+push_back(TData&& data)
+{
+    entry_vec_.push_back(SEntry {
+            .data = std::move(data), .next = NULL_IDX, .prev = tail_
+        });
+
+    return link_back();
+}
+
+/**
+ * @return iterator to the back entry
+ * @see push_back()
+ */
+template<typename TData>
+CBacktrackArenaList<TData>::CIterator
+CBacktrackArenaList<TData>::
+link_back()
+{
+    const auto idx = static_cast<TIndex>(entry_vec_.size() - 1u);
+
+    if (tail_ != NULL_IDX) entry_vec_[tail_].next = idx;
+    else                   head_ = idx;
+
+    tail_ = idx;
+    ++size_;
+
+    return CIterator(this, idx);
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CBACKTRACKARENALIST_HPP_
@@ -0,0 +1,841 @@
+#ifndef TINYSAT_CBACKTRACKCOMPACTSKIPLIST_HPP_
+#define TINYSAT_CBACKTRACKCOMPACTSKIPLIST_HPP_
+
+/**
+ * @file CBacktrackCompactSkiplist.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "CRandom.hpp"
+
+/// @brief
+namespace tinysat {
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData> class
+//----------------------------------------
+
+/// Compact skiplist able to extract/restore its nodes
+/**
+ * Implements the CBacktrackSkiplist interface in the structure-of-arrays
+ * layout with 32-bit links. Level 0 links of all the elements are
+ * contiguous, while the links of the higher levels are stored only
+ * for the elements present there, packed element by element,
+ * so with the levels' probability 1/2 it takes 2 links per element
+ * on average instead of 2*MAX_LOG.
+ * Heads and tails of all the levels share a single cache line.
+ */
+template<typename TData>
+class CBacktrackCompactSkiplist
+{
+public:
+    using TIndex = uint32_t; ///< Type of the links
+
+    /// Null index representation
+    static constexpr TIndex NULL_IDX = static_cast<TIndex>(-1);
+    /// Width of the skiplist, heads and tails fill a cache line
+    static constexpr size_t MAX_LOG = 8u;
+
+    class CNode; ///< Node holding extracted value
+    class CIterator; ///< Iterator class.
+    class CConstIterator; ///< ConstIterator class.
+
+    using data_type = TData; ///< Type of internal data
+    using node_type = CNode; ///< Type of node holding extracted value
+    using iterator = CIterator; ///< BidirIt alias
+    using const_iterator = CConstIterator; ///< ConstBidirIt alias
+
+    /// Pair of links of the single level
+    struct SLink
+    {
+        TIndex next; ///< Successor's index
+        TIndex prev; ///< Predecessor's index
+    };
+
+    /// Heads and tails of all the levels
+    struct alignas(64u) SBoundBlock
+    {
+        TIndex head[MAX_LOG]; ///< Front element of the level
+        TIndex tail[MAX_LOG]; ///< Back element of the level
+    };
+
+    /// Default ctor
+    CBacktrackCompactSkiplist() = default;
+
+    /// Copy ctor from data vector
+    explicit CBacktrackCompactSkiplist(const std::vector<TData>&);
+    /// Move ctor from data vector
+    explicit CBacktrackCompactSkiplist(std::vector<TData>&&);
+
+    /// Ctor from range
+    template<typename TIter>
+    CBacktrackCompactSkiplist(TIter&&, TIter&&);
+
+    /// Rule of 5
+    CBacktrackCompactSkiplist(const CBacktrackCompactSkiplist&) = default;
+    /// Rule of 5
+    CBacktrackCompactSkiplist&
+    operator = (const CBacktrackCompactSkiplist&) = default;
+
+    /// Rule of 5
+    CBacktrackCompactSkiplist(CBacktrackCompactSkiplist&&) = default;
+    /// Rule of 5
+    CBacktrackCompactSkiplist&
+    operator = (CBacktrackCompactSkiplist&&) = default;
+
+    /// Returns size
+    /**
+     * @return elements' count
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// Returns true iff empty
+    /**
+     * @return size() == 0
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the front element
+     * @see CIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CIterator begin()
+    {
+        return CIterator(this, bound_blk_.head[0u]);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the front element
+     * @see CConstIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CConstIterator begin() const
+    {
+        return CConstIterator(this, bound_blk_.head[0u]);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the front element
+     * @see CConstIterator begin() end() cend()
+     */
+    [[nodiscard]] CConstIterator cbegin() const
+    {
+        return begin();
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the past-to-end element
+     * @see CIterator begin() cbegin() cend()
+     */
+    [[nodiscard]] CIterator end()
+    {
+        return CIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() cend()
+     */
+    [[nodiscard]] CConstIterator end() const
+    {
+        return CConstIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() end()
+     */
+    [[nodiscard]] CConstIterator cend() const
+    {
+        return end();
+    }
+
+    /// Reassign all links basing on current data
+    void reset();
+
+    /// Extract corresonding value and links
+    CNode extract(CIterator);
+    /// Restore corresonding value and links
+    CIterator restore(CNode&&);
+
+    /// Find value
+    [[nodiscard]] CIterator find(const TData&);
+    /// Find value
+    [[nodiscard]] CConstIterator find(const TData&) const;
+
+    /// Simple check for errors
+    [[nodiscard]] bool ok() const noexcept;
+
+protected:
+    /// Gives an access to the corresponding value
+    /**
+     * @param [in] idx internal element index
+     * @return corresponding value
+     */
+    [[nodiscard]] TData& at(const TIndex idx)
+    {
+        return data_vec_[idx];
+    }
+
+    /// Gives an access to the corresponding value
+    /**
+     * @param [in] idx internal element's index
+     * @return corresponding value
+     */
+    [[nodiscard]] const TData& at(const TIndex idx) const
+    {
+        return data_vec_[idx];
+    }
+
+    /// Returns links of the element at the level
+    /**
+     * @param [in] idx internal element's index
+     * @param [in] log level below the element's height
+     * @return element's links
+     */
+    [[nodiscard]] SLink& link(const TIndex idx, const size_t log)
+    {
+        return (log == 0u ? base_link_vec_[idx] :
+                            tower_link_vec_[tower_vec_[idx] + log - 1u]);
+    }
+
+    /// Returns index of the prev element
+    /**
+     * @param [in] idx internal element's index
+     * @return prev element's index
+     */
+    [[nodiscard]] TIndex prev(const TIndex idx) const
+    {
+        return (idx == NULL_IDX ? bound_blk_.tail[0u] :
+                                  base_link_vec_[idx].prev);
+    }
+
+    /// Returns index of the next element
+    /**
+     * @param [in] idx internal element's index
+     * @return next element's index
+     */
+    [[nodiscard]] TIndex next(const TIndex idx) const
+    {
+        return base_link_vec_[idx].next;
+    }
+
+private:
+    SBoundBlock bound_blk_;
+    TIndex size_ = 0u;
+
+    std::vector<TData> data_vec_;
+    std::vector<SLink> base_link_vec_;
+    std::vector<uint8_t> height_vec_;
+
+    // offsets of the elements' level 1+ links in tower_link_vec_
+    std::vector<TIndex> tower_vec_;
+    std::vector<SLink> tower_link_vec_;
+};
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CNode class
+//----------------------------------------
+
+/**
+ * Holds index of extracted element
+ */
+template<typename TData>
+class CBacktrackCompactSkiplist<TData>::CNode
+{
+public:
+    friend class CBacktrackCompactSkiplist<TData>;
+
+    /// Ctor from pointer to parent list and index
+    CNode(CBacktrackCompactSkiplist<TData>*, const TIndex);
+
+    CNode             (const CNode&) = delete; ///< Rule of 5
+    CNode& operator = (const CNode&) = delete; ///< Rule of 5
+
+    CNode             (CNode&&) = default; ///< Rule of 5
+    CNode& operator = (CNode&&) = default; ///< Rule of 5
+
+    /// Access corresponding element
+    [[nodiscard]] TData& get() const;
+
+private:
+    CBacktrackCompactSkiplist<TData>* list_ptr_;
+    TIndex elem_idx_;
+};
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CIterator class
+//----------------------------------------
+
+/**
+ * Implements bidirectional iterator
+ * for the CBacktrackCompactSkiplist template
+ */
+template<typename TData>
+class CBacktrackCompactSkiplist<TData>::CIterator
+{
+public:
+    friend class CBacktrackCompactSkiplist<TData>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits.
+    using value_type = TData; ///< Traits.
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits.
+
+    /// Default ctor
+    CIterator() = default;
+
+    /// Ctor from list pointer and element index
+    CIterator(CBacktrackCompactSkiplist<TData>*, const TIndex);
+
+    CIterator             (const CIterator&) = default; ///< Rule of 5
+    CIterator& operator = (const CIterator&) = default; ///< Rule of 5
+
+    CIterator             (CIterator&&) = default; ///< Rule of 5
+    CIterator& operator = (CIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] TData* operator -> () const; ///< InputIt interface
+
+    CIterator& operator ++ (); ///< InputIt interface
+    CIterator& operator -- (); ///< BidirIt interface
+
+    const CIterator operator ++ (int); ///< InputIt interface
+    const CIterator operator -- (int); ///< BidirIt interface
+
+    /// Implicit conversion to the CConstIterator
+    operator CBacktrackCompactSkiplist<TData>::CConstIterator () const;
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CIterator& lhs, const CIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.elem_idx_ == rhs.elem_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CIterator& lhs, const CIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    CBacktrackCompactSkiplist<TData>* list_ptr_ = nullptr;
+    TIndex elem_idx_ = CBacktrackCompactSkiplist<TData>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CConstIterator class
+//----------------------------------------
+
+/**
+ * Implements constant bidirectional iterator
+ * for the CBacktrackCompactSkiplist template
+ */
+template<typename TData>
+class CBacktrackCompactSkiplist<TData>::CConstIterator
+{
+public:
+    friend class CBacktrackCompactSkiplist<TData>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits.
+    using value_type = const TData; ///< Traits.
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits.
+
+    /// Default ctor
+    CConstIterator() = default;
+
+    /// Ctor from list pointer and element index
+    CConstIterator(const CBacktrackCompactSkiplist<TData>*, const TIndex);
+
+    CConstIterator             (const CConstIterator&) = default; ///< Rule of 5
+    CConstIterator& operator = (const CConstIterator&) = default; ///< Rule of 5
+
+    CConstIterator             (CConstIterator&&) = default; ///< Rule of 5
+    CConstIterator& operator = (CConstIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] const TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] const TData* operator -> () const; ///< InputIt interface
+
+    CConstIterator& operator ++ (); ///< InputIt interface
+    CConstIterator& operator -- (); ///< BidirIt interface
+
+    const CConstIterator operator ++ (int); ///< InputIt interface
+    const CConstIterator operator -- (int); ///< BidirIt interface
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.elem_idx_ == rhs.elem_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const CBacktrackCompactSkiplist<TData>* list_ptr_ = nullptr;
+    TIndex elem_idx_ = CBacktrackCompactSkiplist<TData>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CNode methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent list
+ * @param [in] elem_idx index of the extracted element
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::CNode::
+CNode(CBacktrackCompactSkiplist<TData>* list_ptr, const TIndex elem_idx):
+    list_ptr_{ list_ptr },
+    elem_idx_{ elem_idx }
+{}
+
+/**
+ * @return reference to the extracted value
+ */
+template<typename TData>
+TData&
+CBacktrackCompactSkiplist<TData>::CNode::
+get() const
+{
+    return list_ptr_->at(elem_idx_);
+}
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent list
+ * @param [in] elem_idx index of the pointed-to element
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::CIterator::
+CIterator(CBacktrackCompactSkiplist<TData>* list_ptr,
+          const TIndex elem_idx):
+    list_ptr_{ list_ptr },
+    elem_idx_{ elem_idx }
+{}
+
+/**
+ * @return reference to pointed-to value
+ */
+template<typename TData>
+TData&
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator * () const
+{
+    return list_ptr_->at(elem_idx_);
+}
+
+/**
+ * @return pointer to pointed-to value
+ */
+template<typename TData>
+TData*
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return *this
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CIterator&
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator ++ ()
+{
+    elem_idx_ = list_ptr_->next(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return *this
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CIterator&
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator -- ()
+{
+    elem_idx_ = list_ptr_->prev(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const typename CBacktrackCompactSkiplist<TData>::CIterator
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const typename CBacktrackCompactSkiplist<TData>::CIterator
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+/**
+ * @return corresponding CConstIterator
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::CIterator::
+operator CBacktrackCompactSkiplist<TData>::CConstIterator () const
+{
+    return CConstIterator(list_ptr_, elem_idx_);
+}
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData>::CConstIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent list
+ * @param [in] elem_idx index of the pointed-to element
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+CConstIterator(const CBacktrackCompactSkiplist<TData>* list_ptr,
+               const TIndex elem_idx):
+    list_ptr_{ list_ptr },
+    elem_idx_{ elem_idx }
+{}
+
+/**
+ * @return reference to pointed-to value
+ */
+template<typename TData>
+const TData&
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator * () const
+{
+    return list_ptr_->at(elem_idx_);
+}
+
+/**
+ * @return pointer to pointed-to value
+ */
+template<typename TData>
+const TData*
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return *this
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CConstIterator&
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator ++ ()
+{
+    elem_idx_ = list_ptr_->next(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return *this
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CConstIterator&
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator -- ()
+{
+    elem_idx_ = list_ptr_->prev(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const typename CBacktrackCompactSkiplist<TData>::CConstIterator
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData>
+const typename CBacktrackCompactSkiplist<TData>::CConstIterator
+CBacktrackCompactSkiplist<TData>::CConstIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+//----------------------------------------
+// CBacktrackCompactSkiplist<TData> methods
+//----------------------------------------
+
+/**
+ * @param [in] data_vec data vector to copy
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::
+CBacktrackCompactSkiplist(const std::vector<TData>& data_vec):
+    data_vec_(data_vec)
+{
+    reset();
+}
+
+/**
+ * @param [in,out] data_vec data vector to move
+ */
+template<typename TData>
+CBacktrackCompactSkiplist<TData>::
+CBacktrackCompactSkiplist(std::vector<TData>&& data_vec):
+    data_vec_(std::move(data_vec))
+{
+    reset();
+}
+
+/**
+ * @param [in] begin_it range begin iterator
+ * @param [in] end_it range end iterator
+ */
+template<typename TData>
+template<typename TIter>
+CBacktrackCompactSkiplist<TData>::
+CBacktrackCompactSkiplist(TIter&& begin_it, TIter&& end_it):
+    data_vec_(std::forward<TIter>(begin_it), std::forward<TIter>(end_it))
+{
+    reset();
+}
+
+/**
+ * Heights are drawn first, so the towers are packed in the elements' order.
+ */
+template<typename TData>
+void CBacktrackCompactSkiplist<TData>::reset()
+{
+    auto& random = CRandom::local();
+
+    size_ = static_cast<TIndex>(data_vec_.size());
+    std::fill(std::begin(bound_blk_.head), std::end(bound_blk_.head),
+              NULL_IDX);
+    std::fill(std::begin(bound_blk_.tail), std::end(bound_blk_.tail),
+              NULL_IDX);
+
+    std::sort(std::begin(data_vec_), std::end(data_vec_));
+
+    height_vec_.assign(size_, 1u);
+    tower_vec_.assign(size_, NULL_IDX);
+    tower_link_vec_.clear();
+
+    for (TIndex idx = 0u; idx < size_; ++idx)
+    {
+        const size_t height = random.geometric(MAX_LOG);
+
+        height_vec_[idx] = static_cast<uint8_t>(height);
+        if (height > 1u)
+        {
+            tower_vec_[idx] = static_cast<TIndex>(tower_link_vec_.size());
+            tower_link_vec_.resize(tower_link_vec_.size() + height - 1u);
+        }
+    }
+
+    base_link_vec_.resize(size_);
+    for (size_t log = 0u; log < MAX_LOG; ++log)
+    {
+        TIndex& head = bound_blk_.head[log];
+        TIndex& tail = bound_blk_.tail[log];
+
+        for (TIndex idx = 0u; idx < size_; ++idx)
+        {
+            if (height_vec_[idx] <= log)
+                continue;
+
+            SLink& cur = link(idx, log);
+            cur.next = NULL_IDX;
+            cur.prev = tail;
+
+            if (tail == NULL_IDX) head = idx;
+            else                  link(tail, log).next = idx;
+
+            tail = idx;
+        }
+    }
+}
+
+/**
+ * @return true iff no errors are found
+ */
+template<typename TData>
+bool CBacktrackCompactSkiplist<TData>::ok() const noexcept
+{
+    bool result = true;
+
+    result = result && (size_ <= data_vec_.size());
+    result = result && (data_vec_.size() == base_link_vec_.size());
+    result = result && (data_vec_.size() == height_vec_.size());
+    result = result && (data_vec_.size() == tower_vec_.size());
+
+    for (size_t log = 0u; log < MAX_LOG; ++log)
+        result = result &&
+            ((bound_blk_.head[log] == NULL_IDX) ==
+             (bound_blk_.tail[log] == NULL_IDX));
+
+    return result;
+}
+
+/**
+ * @param [in,out] node node representing previously extracted element
+ * @return iterator pointing to the restored element
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CIterator
+CBacktrackCompactSkiplist<TData>::restore(CNode&& node)
+{
+    const TIndex idx = std::move(node).elem_idx_;
+
+    for (size_t log = 0u; log < height_vec_[idx]; ++log)
+    {
+        const SLink cur = link(idx, log);
+
+        if (cur.prev == NULL_IDX) bound_blk_.head[log] = idx;
+        else                      link(cur.prev, log).next = idx;
+
+        if (cur.next == NULL_IDX) bound_blk_.tail[log] = idx;
+        else                      link(cur.next, log).prev = idx;
+    }
+
+    ++size_;
+
+    return CIterator(this, idx);
+}
+
+/**
+ * @param [in] iter iterator pointing to the element to extract
+ * @return node representing the extracted element
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CNode
+CBacktrackCompactSkiplist<TData>::extract(const CIterator iter)
+{
+    const TIndex idx = iter.elem_idx_;
+
+    for (size_t log = 0u; log < height_vec_[idx]; ++log)
+    {
+        const SLink cur = link(idx, log);
+
+        if (cur.prev != NULL_IDX) link(cur.prev, log).next = cur.next;
+        else                      bound_blk_.head[log] = cur.next;
+
+        if (cur.next != NULL_IDX) link(cur.next, log).prev = cur.prev;
+        else                      bound_blk_.tail[log] = cur.prev;
+    }
+
+    --size_;
+
+    return CNode(this, idx);
+}
+
+/**
+ * @param [in] value value to search for
+ * @return iterator pointing to the found value or end() if no such exists
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CIterator
+CBacktrackCompactSkiplist<TData>::find(const TData& value)
+{
+    size_t log = MAX_LOG - 1u;
+    //comparison via unsigned overflow
+    while (log < MAX_LOG && (bound_blk_.head[log] == NULL_IDX ||
+           value < data_vec_[bound_blk_.head[log]]))
+    {
+        --log;
+    }
+
+    TIndex idx = (log < MAX_LOG ? bound_blk_.head[log] : NULL_IDX);
+    //comparison via unsigned overflow
+    while (log < MAX_LOG)
+    {
+        while (idx != NULL_IDX && data_vec_[idx] < value)
+            idx = link(idx, log).next;
+
+        if (idx == NULL_IDX)             idx = bound_blk_.tail[log];
+        else if (value < data_vec_[idx]) idx = link(idx, log).prev;
+        else                             break;
+
+        --log;
+    }
+
+    if (idx == NULL_IDX || data_vec_[idx] < value || value < data_vec_[idx])
+        idx = NULL_IDX;
+
+    return CIterator(this, idx);
+}
+
+/**
+ * @param [in] value value to search for
+ * @return iterator pointing to the found value or end() if no such exists
+ */
+template<typename TData>
+typename CBacktrackCompactSkiplist<TData>::CConstIterator
+CBacktrackCompactSkiplist<TData>::find(const TData& value) const
+{
+    return const_cast<CBacktrackCompactSkiplist*>(this)->find(value);
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CBACKTRACKCOMPACTSKIPLIST_HPP_
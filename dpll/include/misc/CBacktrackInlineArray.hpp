@@ -0,0 +1,833 @@
+#ifndef TINYSAT_CBACKTRACKINLINEARRAY_HPP_
+#define TINYSAT_CBACKTRACKINLINEARRAY_HPP_
+
+/**
+ * @file CBacktrackInlineArray.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/// @brief
+namespace tinysat {
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY> class
+//----------------------------------------
+
+/// Small array able to extract/restore its elements
+/**
+ * Stores up to CAPACITY elements inline and longer sequences
+ * in the heap buffer. Active elements form the prefix of the storage,
+ * so extraction swaps the element with the last active one
+ * and restoration swaps it back. Therefore elements are unordered
+ * and nodes must be restored in the reverse order of extraction,
+ * as the formula's backtracking does.
+ * Inline find compares the whole storage at once
+ * and masks off the lanes past size().
+ */
+template<typename TData, size_t CAPACITY = 8u>
+class CBacktrackInlineArray
+{
+public:
+    using TIndex = uint32_t; ///< Type of the indices
+    using TMask = uint32_t; ///< Type of the lanes' bitmask
+
+    /// Null index representation
+    static constexpr TIndex NULL_IDX = static_cast<TIndex>(-1);
+
+    static_assert(CAPACITY <= 8u*sizeof(TMask),
+                  "error: lanes don't fit the mask");
+
+    class CNode; ///< Node holding extracted value
+    class CIterator; ///< Iterator class.
+    class CConstIterator; ///< ConstIterator class.
+
+    using data_type = TData; ///< Type of internal data
+    using node_type = CNode; ///< Type of node holding extracted value
+    using iterator = CIterator; ///< BidirIt alias
+    using const_iterator = CConstIterator; ///< ConstBidirIt alias
+
+    /// Default ctor
+    CBacktrackInlineArray() = default;
+
+    /// Copy ctor from data vector
+    explicit CBacktrackInlineArray(const std::vector<TData>&);
+    /// Move ctor from data vector
+    explicit CBacktrackInlineArray(std::vector<TData>&&);
+
+    /// Ctor from range
+    template<typename TIter>
+    CBacktrackInlineArray(TIter&&, TIter&&);
+
+    /// Rule of 5
+    CBacktrackInlineArray(const CBacktrackInlineArray&) = default;
+    /// Rule of 5
+    CBacktrackInlineArray& operator = (const CBacktrackInlineArray&) = default;
+
+    /// Rule of 5
+    CBacktrackInlineArray(CBacktrackInlineArray&&) = default;
+    /// Rule of 5
+    CBacktrackInlineArray& operator = (CBacktrackInlineArray&&) = default;
+
+    /// Returns size
+    /**
+     * @return active elements' count
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// Returns true iff empty
+    /**
+     * @return size() == 0
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    /// Returns true iff elements are stored inline
+    /**
+     * @return total count <= CAPACITY
+     */
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+        return heap_vec_.empty();
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the front element
+     * @see CIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CIterator begin()
+    {
+        return CIterator(this, size_ == 0u ? NULL_IDX : 0u);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the front element
+     * @see CConstIterator cbegin() end() cend()
+     */
+    [[nodiscard]] CConstIterator begin() const
+    {
+        return CConstIterator(this, size_ == 0u ? NULL_IDX : 0u);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the front element
+     * @see CConstIterator begin() end() cend()
+     */
+    [[nodiscard]] CConstIterator cbegin() const
+    {
+        return begin();
+    }
+
+    /// STL-like interface
+    /**
+     * @return iterator pointing to the past-to-end element
+     * @see CIterator begin() cbegin() cend()
+     */
+    [[nodiscard]] CIterator end()
+    {
+        return CIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() cend()
+     */
+    [[nodiscard]] CConstIterator end() const
+    {
+        return CConstIterator(this, NULL_IDX);
+    }
+
+    /// STL-like interface
+    /**
+     * @return const iterator pointing to the past-to-end element
+     * @see CConstIterator begin() cbegin() end()
+     */
+    [[nodiscard]] CConstIterator cend() const
+    {
+        return end();
+    }
+
+    /// Extract corresonding value
+    CNode extract(CIterator);
+    /// Restore corresonding value
+    CIterator restore(CNode&&);
+
+    /// Find value
+    [[nodiscard]] CIterator find(const TData&);
+    /// Find value
+    [[nodiscard]] CConstIterator find(const TData&) const;
+
+    /// Simple check for errors
+    [[nodiscard]] bool ok() const noexcept;
+
+protected:
+    /// True iff TData can be compared lane-wise as 32-bit words
+    static constexpr bool IS_SIMD =
+        sizeof(TData) == sizeof(uint32_t) && CAPACITY%4u == 0u &&
+        std::has_unique_object_representations_v<TData>;
+
+    /// Returns pointer to the storage
+    [[nodiscard]] TData* data() noexcept
+    {
+        return (is_inline() ? inline_arr_.data() : heap_vec_.data());
+    }
+
+    /// Returns pointer to the storage
+    [[nodiscard]] const TData* data() const noexcept
+    {
+        return (is_inline() ? inline_arr_.data() : heap_vec_.data());
+    }
+
+    /// Gives an access to the corresponding value
+    /**
+     * @param [in] idx internal element index
+     * @return corresponding value
+     */
+    [[nodiscard]] TData& at(const TIndex idx)
+    {
+        return data()[idx];
+    }
+
+    /// Gives an access to the corresponding value
+    /**
+     * @param [in] idx internal element's index
+     * @return corresponding value
+     */
+    [[nodiscard]] const TData& at(const TIndex idx) const
+    {
+        return data()[idx];
+    }
+
+    /// Returns index of the prev element
+    /**
+     * @param [in] idx internal element's index
+     * @return prev element's index
+     */
+    [[nodiscard]] TIndex prev(const TIndex idx) const
+    {
+        return (idx == NULL_IDX ? size_ - 1u : idx - 1u);
+    }
+
+    /// Returns index of the next element
+    /**
+     * @param [in] idx internal element's index
+     * @return next element's index
+     */
+    [[nodiscard]] TIndex next(const TIndex idx) const
+    {
+        return (idx + 1u < size_ ? idx + 1u : NULL_IDX);
+    }
+
+    /// Places the data to the inline or heap storage
+    void assign(std::vector<TData>&&);
+
+    /// Finds value among the inline elements
+    [[nodiscard]] TIndex find_inline(const TData&) const;
+
+private:
+    std::array<TData, CAPACITY> inline_arr_ = {};
+    std::vector<TData> heap_vec_;
+
+    TIndex size_ = 0u;
+    TIndex count_ = 0u;
+};
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CNode class
+//----------------------------------------
+
+/**
+ * Holds the element's slot past the active ones
+ * and the index it was extracted from
+ */
+template<typename TData, size_t CAPACITY>
+class CBacktrackInlineArray<TData, CAPACITY>::CNode
+{
+public:
+    friend class CBacktrackInlineArray<TData, CAPACITY>;
+
+    /// Ctor from pointer to parent array, slot and hole indices
+    CNode(CBacktrackInlineArray<TData, CAPACITY>*,
+          const TIndex, const TIndex);
+
+    CNode             (const CNode&) = delete; ///< Rule of 5
+    CNode& operator = (const CNode&) = delete; ///< Rule of 5
+
+    CNode             (CNode&&) = default; ///< Rule of 5
+    CNode& operator = (CNode&&) = default; ///< Rule of 5
+
+    /// Access corresponding element
+    [[nodiscard]] TData& get() const;
+
+private:
+    CBacktrackInlineArray<TData, CAPACITY>* list_ptr_;
+    TIndex slot_idx_;
+    TIndex hole_idx_;
+};
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CIterator class
+//----------------------------------------
+
+/**
+ * Implements bidirectional iterator
+ * for the CBacktrackInlineArray template
+ */
+template<typename TData, size_t CAPACITY>
+class CBacktrackInlineArray<TData, CAPACITY>::CIterator
+{
+public:
+    friend class CBacktrackInlineArray<TData, CAPACITY>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits.
+    using value_type = TData; ///< Traits.
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits.
+
+    /// Default ctor
+    CIterator() = default;
+
+    /// Ctor from array pointer and element index
+    CIterator(CBacktrackInlineArray<TData, CAPACITY>*, const TIndex);
+
+    CIterator             (const CIterator&) = default; ///< Rule of 5
+    CIterator& operator = (const CIterator&) = default; ///< Rule of 5
+
+    CIterator             (CIterator&&) = default; ///< Rule of 5
+    CIterator& operator = (CIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] TData* operator -> () const; ///< InputIt interface
+
+    CIterator& operator ++ (); ///< InputIt interface
+    CIterator& operator -- (); ///< BidirIt interface
+
+    const CIterator operator ++ (int); ///< InputIt interface
+    const CIterator operator -- (int); ///< BidirIt interface
+
+    /// Implicit conversion to the CConstIterator
+    operator CBacktrackInlineArray<TData, CAPACITY>::CConstIterator () const;
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CIterator& lhs, const CIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.elem_idx_ == rhs.elem_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CIterator& lhs, const CIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    CBacktrackInlineArray<TData, CAPACITY>* list_ptr_ = nullptr;
+    TIndex elem_idx_ = CBacktrackInlineArray<TData, CAPACITY>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CConstIterator class
+//----------------------------------------
+
+/**
+ * Implements constant bidirectional iterator
+ * for the CBacktrackInlineArray template
+ */
+template<typename TData, size_t CAPACITY>
+class CBacktrackInlineArray<TData, CAPACITY>::CConstIterator
+{
+public:
+    friend class CBacktrackInlineArray<TData, CAPACITY>;
+
+    using difference_type = std::ptrdiff_t; ///< Traits.
+    using value_type = const TData; ///< Traits.
+    using reference = value_type&; ///< Traits
+    using pointer = value_type*; ///< Traits
+    using iterator_category = std::bidirectional_iterator_tag; ///< Traits.
+
+    /// Default ctor
+    CConstIterator() = default;
+
+    /// Ctor from array pointer and element index
+    CConstIterator(const CBacktrackInlineArray<TData, CAPACITY>*,
+                   const TIndex);
+
+    CConstIterator             (const CConstIterator&) = default; ///< Rule of 5
+    CConstIterator& operator = (const CConstIterator&) = default; ///< Rule of 5
+
+    CConstIterator             (CConstIterator&&) = default; ///< Rule of 5
+    CConstIterator& operator = (CConstIterator&&) = default; ///< Rule of 5
+
+    [[nodiscard]] const TData& operator * () const; ///< InputIt interface
+    [[nodiscard]] const TData* operator -> () const; ///< InputIt interface
+
+    CConstIterator& operator ++ (); ///< InputIt interface
+    CConstIterator& operator -- (); ///< BidirIt interface
+
+    const CConstIterator operator ++ (int); ///< InputIt interface
+    const CConstIterator operator -- (int); ///< BidirIt interface
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator == (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return (lhs.list_ptr_ == rhs.list_ptr_) &&
+               (lhs.elem_idx_ == rhs.elem_idx_);
+    }
+
+    /// InputIt interface
+    [[nodiscard]] friend
+    bool operator != (const CConstIterator& lhs, const CConstIterator& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    const CBacktrackInlineArray<TData, CAPACITY>* list_ptr_ = nullptr;
+    TIndex elem_idx_ = CBacktrackInlineArray<TData, CAPACITY>::NULL_IDX;
+};
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CNode methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent array
+ * @param [in] slot_idx index the extracted element is moved to
+ * @param [in] hole_idx index the element is extracted from
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::CNode::
+CNode(CBacktrackInlineArray<TData, CAPACITY>* list_ptr,
+      const TIndex slot_idx, const TIndex hole_idx):
+    list_ptr_{ list_ptr },
+    slot_idx_{ slot_idx },
+    hole_idx_{ hole_idx }
+{}
+
+/**
+ * @return reference to the extracted value
+ */
+template<typename TData, size_t CAPACITY>
+TData&
+CBacktrackInlineArray<TData, CAPACITY>::CNode::
+get() const
+{
+    return list_ptr_->at(slot_idx_);
+}
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent array
+ * @param [in] elem_idx index of the pointed-to element
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+CIterator(CBacktrackInlineArray<TData, CAPACITY>* list_ptr,
+          const TIndex elem_idx):
+    list_ptr_{ list_ptr },
+    elem_idx_{ elem_idx }
+{}
+
+/**
+ * @return reference to pointed-to value
+ */
+template<typename TData, size_t CAPACITY>
+TData&
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator * () const
+{
+    return list_ptr_->at(elem_idx_);
+}
+
+/**
+ * @return pointer to pointed-to value
+ */
+template<typename TData, size_t CAPACITY>
+TData*
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return *this
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CIterator&
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator ++ ()
+{
+    elem_idx_ = list_ptr_->next(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return *this
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CIterator&
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator -- ()
+{
+    elem_idx_ = list_ptr_->prev(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData, size_t CAPACITY>
+const typename CBacktrackInlineArray<TData, CAPACITY>::CIterator
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData, size_t CAPACITY>
+const typename CBacktrackInlineArray<TData, CAPACITY>::CIterator
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+/**
+ * @return corresponding CConstIterator
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::CIterator::
+operator CBacktrackInlineArray<TData, CAPACITY>::CConstIterator () const
+{
+    return CConstIterator(list_ptr_, elem_idx_);
+}
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY>::CConstIterator methods
+//----------------------------------------
+
+/**
+ * @param [in] list_ptr pointer to the parent array
+ * @param [in] elem_idx index of the pointed-to element
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+CConstIterator(const CBacktrackInlineArray<TData, CAPACITY>* list_ptr,
+               const TIndex elem_idx):
+    list_ptr_{ list_ptr },
+    elem_idx_{ elem_idx }
+{}
+
+/**
+ * @return reference to pointed-to value
+ */
+template<typename TData, size_t CAPACITY>
+const TData&
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator * () const
+{
+    return list_ptr_->at(elem_idx_);
+}
+
+/**
+ * @return pointer to pointed-to value
+ */
+template<typename TData, size_t CAPACITY>
+const TData*
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator -> () const
+{
+    return &(*(*this));
+}
+
+/**
+ * @return *this
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CConstIterator&
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator ++ ()
+{
+    elem_idx_ = list_ptr_->next(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return *this
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CConstIterator&
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator -- ()
+{
+    elem_idx_ = list_ptr_->prev(elem_idx_);
+    return *this;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData, size_t CAPACITY>
+const typename CBacktrackInlineArray<TData, CAPACITY>::CConstIterator
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator ++ (int)
+{
+    const auto that = *this;
+    ++(*this);
+
+    return that;
+}
+
+/**
+ * @return old *this
+ */
+template<typename TData, size_t CAPACITY>
+const typename CBacktrackInlineArray<TData, CAPACITY>::CConstIterator
+CBacktrackInlineArray<TData, CAPACITY>::CConstIterator::
+operator -- (int)
+{
+    const auto that = *this;
+    --(*this);
+
+    return that;
+}
+
+//----------------------------------------
+// CBacktrackInlineArray<TData, CAPACITY> methods
+//----------------------------------------
+
+/**
+ * @param [in] data_vec data vector to copy
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::
+CBacktrackInlineArray(const std::vector<TData>& data_vec)
+{
+    assign(std::vector<TData>(data_vec));
+}
+
+/**
+ * @param [in,out] data_vec data vector to move
+ */
+template<typename TData, size_t CAPACITY>
+CBacktrackInlineArray<TData, CAPACITY>::
+CBacktrackInlineArray(std::vector<TData>&& data_vec)
+{
+    assign(std::move(data_vec));
+}
+
+/**
+ * @param [in] begin_it range begin iterator
+ * @param [in] end_it range end iterator
+ */
+template<typename TData, size_t CAPACITY>
+template<typename TIter>
+CBacktrackInlineArray<TData, CAPACITY>::
+CBacktrackInlineArray(TIter&& begin_it, TIter&& end_it)
+{
+    assign(std::vector<TData>(std::forward<TIter>(begin_it),
+                              std::forward<TIter>(end_it)));
+}
+
+/**
+ * @param [in,out] data_vec data to store
+ */
+template<typename TData, size_t CAPACITY>
+void CBacktrackInlineArray<TData, CAPACITY>::
+assign(std::vector<TData>&& data_vec)
+{
+    size_ = count_ = static_cast<TIndex>(data_vec.size());
+
+    if (count_ <= CAPACITY)
+        std::move(std::begin(data_vec), std::end(data_vec),
+                  std::begin(inline_arr_));
+    else
+        heap_vec_ = std::move(data_vec);
+}
+
+/**
+ * @return true iff no errors are found
+ */
+template<typename TData, size_t CAPACITY>
+bool CBacktrackInlineArray<TData, CAPACITY>::ok() const noexcept
+{
+    bool result = true;
+
+    result = result && (size_ <= count_);
+    result = result && (is_inline() ? count_ <= CAPACITY :
+                                      count_ == heap_vec_.size());
+
+    return result;
+}
+
+/**
+ * @param [in,out] node node representing the last extracted element
+ * @return iterator pointing to the restored element
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CIterator
+CBacktrackInlineArray<TData, CAPACITY>::restore(CNode&& node)
+{
+    const TIndex hole_idx = std::move(node).hole_idx_;
+
+    std::swap(at(hole_idx), at(size_));
+    ++size_;
+
+    return CIterator(this, hole_idx);
+}
+
+/**
+ * @param [in] iter iterator pointing to the element to extract
+ * @return node representing the extracted element
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CNode
+CBacktrackInlineArray<TData, CAPACITY>::extract(const CIterator iter)
+{
+    const TIndex hole_idx = iter.elem_idx_;
+
+    --size_;
+    std::swap(at(hole_idx), at(size_));
+
+    return CNode(this, size_, hole_idx);
+}
+
+/**
+ * @param [in] value value to search for
+ * @return index of the found value or NULL_IDX if no such exists
+ *
+ * Compares all CAPACITY lanes, inactive ones are masked off.
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::TIndex
+CBacktrackInlineArray<TData, CAPACITY>::find_inline(const TData& value) const
+{
+    const TMask active = (size_ == 8u*sizeof(TMask) ? ~TMask(0u) :
+                          (TMask(1u) << size_) - 1u);
+    TMask found = 0u;
+
+    if constexpr (IS_SIMD)
+    {
+        uint32_t word = 0u;
+        std::memcpy(&word, &value, sizeof(word));
+
+        const auto* lanes = reinterpret_cast<const char*>(inline_arr_.data());
+
+#if defined(__AVX2__)
+        if constexpr (CAPACITY%8u == 0u)
+        {
+            const __m256i key = _mm256_set1_epi32(static_cast<int>(word));
+            for (size_t lane = 0u; lane < CAPACITY; lane += 8u)
+            {
+                const __m256i cmp = _mm256_cmpeq_epi32(key,
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                                lanes + lane*sizeof(TData))));
+
+                found |= static_cast<TMask>(_mm256_movemask_ps(
+                            _mm256_castsi256_ps(cmp))) << lane;
+            }
+
+            found &= active;
+            return (found == 0u ? NULL_IDX :
+                                  static_cast<TIndex>(__builtin_ctz(found)));
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i key = _mm_set1_epi32(static_cast<int>(word));
+        for (size_t lane = 0u; lane < CAPACITY; lane += 4u)
+        {
+            const __m128i cmp = _mm_cmpeq_epi32(key,
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                            lanes + lane*sizeof(TData))));
+
+            found |= static_cast<TMask>(_mm_movemask_ps(
+                        _mm_castsi128_ps(cmp))) << lane;
+        }
+#else
+        for (size_t lane = 0u; lane < CAPACITY; ++lane)
+            found |= static_cast<TMask>(inline_arr_[lane] == value) << lane;
+#endif
+    }
+    else
+    {
+        for (size_t lane = 0u; lane < CAPACITY; ++lane)
+            found |= static_cast<TMask>(inline_arr_[lane] == value) << lane;
+    }
+
+    found &= active;
+    return (found == 0u ? NULL_IDX :
+                          static_cast<TIndex>(__builtin_ctz(found)));
+}
+
+/**
+ * @param [in] value value to search for
+ * @return iterator pointing to the found value or end() if no such exists
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CIterator
+CBacktrackInlineArray<TData, CAPACITY>::find(const TData& value)
+{
+    if (is_inline())
+        return CIterator(this, find_inline(value));
+
+    const auto active_end = std::begin(heap_vec_) + size_;
+    const auto found_it = std::find(std::begin(heap_vec_), active_end, value);
+
+    return CIterator(this, found_it == active_end ? NULL_IDX :
+            static_cast<TIndex>(found_it - std::begin(heap_vec_)));
+}
+
+/**
+ * @param [in] value value to search for
+ * @return iterator pointing to the found value or end() if no such exists
+ */
+template<typename TData, size_t CAPACITY>
+typename CBacktrackInlineArray<TData, CAPACITY>::CConstIterator
+CBacktrackInlineArray<TData, CAPACITY>::find(const TData& value) const
+{
+    return const_cast<CBacktrackInlineArray*>(this)->find(value);
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CBACKTRACKINLINEARRAY_HPP_
@@ -9,8 +9,10 @@
 
 #include <cstdint>
 
+#include <algorithm>
 #include <vector>
-#include <random>
+
+#include "CRandom.hpp"
 
 /// @brief
 namespace tinysat {
@@ -41,13 +43,13 @@ public:
     using iterator = CIterator; ///< BidirIt alias
     using const_iterator = CConstIterator; ///< ConstBidirIt alias
 
-    // TODO: alignas(64u) for better caching
-    
     /// Represents block of links
     /**
-     * Holds MAX_LOG links as indices and implements array interface
+     * Holds MAX_LOG links as indices and implements array interface,
+     * aligned so as each block takes exactly one cache line
+     * @see CBacktrackCompactSkiplist for the denser layout
      */
-    struct SIndexBlock
+    struct alignas(64u) SIndexBlock
     {
     public:
         SIndexBlock() noexcept
@@ -237,6 +239,7 @@ private:
 
     std::vector<SIndexBlock> prev_blk_vec_;
     std::vector<SIndexBlock> next_blk_vec_;
+    std::vector<uint8_t> height_vec_;
 
     std::vector<TData> data_vec_;
 };
@@ -656,13 +659,13 @@ CBacktrackSkiplist(TIter&& begin_it, TIter&& end_it):
 template<typename TData>
 void CBacktrackSkiplist<TData>::reset()
 {
-    // static can be ommited due to the standard
-    static thread_local std::random_device STATIC_randomizer = {};
+    auto& random = CRandom::local();
 
     size_ = data_vec_.size();
     head_blk_ = tail_blk_ = {};
     prev_blk_vec_.assign(size_, {});
     next_blk_vec_.assign(size_, {});
+    height_vec_.assign(size_, 1u);
 
     std::sort(std::begin(data_vec_), std::end(data_vec_));
 
@@ -680,12 +683,15 @@ void CBacktrackSkiplist<TData>::reset()
         next_blk_vec_.back()[0u] = prev_blk_vec_.front()[0u] = NULL_IDX;
     }
 
+    for (size_t idx = 0u; idx < size_; ++idx)
+        height_vec_[idx] = static_cast<uint8_t>(random.geometric(MAX_LOG));
+
     for (size_t log = 1u; log < MAX_LOG; ++log)
     {
         for (size_t idx = head_blk_[log - 1u]; idx != NULL_IDX; 
              idx = next_blk_vec_[idx][log - 1u])
         {
-            if (STATIC_randomizer()%2u)
+            if (height_vec_[idx] > log)
             {
                 if (head_blk_[log] == NULL_IDX)
                 {
@@ -716,6 +722,7 @@ bool CBacktrackSkiplist<TData>::ok() const noexcept
     result = result && (size_ <= data_vec_.size());
     result = result && (data_vec_.size() == prev_blk_vec_.size());
     result = result && (data_vec_.size() == next_blk_vec_.size());
+    result = result && (data_vec_.size() == height_vec_.size());
 
     for (size_t log = 0u; log < MAX_LOG; ++log)
         result = result && 
@@ -780,13 +787,10 @@ CBacktrackSkiplist<TData>::restore(CNode&& node)
 {
     const size_t idx = std::move(node).elem_idx_;
 
-    for (size_t log = 0u; log < MAX_LOG; ++log)
+    for (size_t log = 0u; log < height_vec_[idx]; ++log)
     {
         size_t prev_idx = prev_blk_vec_[idx][log];
-        size_t next_idx = prev_blk_vec_[idx][log];
-
-        if (prev_idx == NULL_IDX && next_idx == NULL_IDX)
-            break;
+        size_t next_idx = next_blk_vec_[idx][log];
 
         if (prev_idx == NULL_IDX) head_blk_[log] = idx;
         else                      next_blk_vec_[prev_idx][log] = idx;
@@ -810,14 +814,11 @@ CBacktrackSkiplist<TData>::extract(const CIterator iter)
 {
     const size_t idx = iter.elem_idx_;
 
-    for (size_t log = 0u; log < MAX_LOG; ++log)
+    for (size_t log = 0u; log < height_vec_[idx]; ++log)
     {
         size_t prev_idx = prev_blk_vec_[idx][log];
         size_t next_idx = next_blk_vec_[idx][log];
 
-        if (prev_idx == NULL_IDX && next_idx == NULL_IDX)
-            break;
-
         if (prev_idx != NULL_IDX) next_blk_vec_[prev_idx][log] = next_idx;
         else                      head_blk_[log] = next_idx;
 
@@ -21,6 +21,18 @@ CDpllAssignment::CDpllAssignment(const SFormula& formula):
     match_.value_vec = std::vector(formula.params_cnt, SMatch::EValue::NONE);
 }
 
+/**
+ * @param [in] formula SAT formula to assign priorities from
+ */
+void CDpllAssignment::reset(const SFormula& formula)
+{
+    match_.value_vec.assign(formula.params_cnt, SMatch::EValue::NONE);
+    sort_heap_.reset(formula);
+
+    while (!log_stk_.empty())
+        log_stk_.pop();
+}
+
 /**
  * @return state for backtracking
  * @see backtrack()
@@ -45,6 +57,16 @@ void CDpllAssignment::backtrack(const SState& state)
     }
 }
 
+/**
+ * @param [in] clause clause appended to the formula
+ * @see CDpllSortHeap::inc_prior()
+ */
+void CDpllAssignment::add_clause(const std::vector<int>& clause)
+{
+    for (int lit : clause)
+        sort_heap_.inc_prior(lit);
+}
+
 /**
  * @return literal with the highest priority
  * @see proceed()
@@ -96,11 +118,13 @@ void CDpllAssignment::assign(const int lit)
     if (lit == 0)
         throw CException("error: assigning zero literal");
 
-    if (match_.value_vec[std::abs(lit) - 1u] != SMatch::EValue::NONE)
+    const auto code = SDpllLiteral::from_int(lit);
+    auto& value = match_.value_vec[code.param()];
+
+    if (value != SMatch::EValue::NONE)
         throw CException("error: reassigning literal");
 
-    match_.value_vec[std::abs(lit) - 1u] = 
-        (lit < 0 ? SMatch::EValue::FALSE : SMatch::EValue::TRUE);
+    value = code.value();
 
     sort_heap_.extract(lit);
     sort_heap_.extract(-lit);
@@ -115,7 +139,9 @@ void CDpllAssignment::revert(const int lit)
     if (lit == 0)
         throw CException("error: reverting zero literal");
 
-    if (match_.value_vec[std::abs(lit) - 1u] == SMatch::EValue::NONE)
+    auto& value = match_.value_vec[SDpllLiteral::from_int(lit).param()];
+
+    if (value == SMatch::EValue::NONE)
         throw CException("error: reverting not assigned literal");
 
     sort_heap_.restore(-lit);
@@ -123,7 +149,7 @@ void CDpllAssignment::revert(const int lit)
 
     sort_heap_.dec_prior(lit);
 
-    match_.value_vec[std::abs(lit) - 1u] = SMatch::EValue::NONE;
+    value = SMatch::EValue::NONE;
 }
 
 } // namespace tinysat
@@ -15,6 +15,7 @@ namespace tinysat {
  */
 CDpllContext::CDpllContext(const SFormula& formula):
     assignment_(formula),
+    lookahead_(formula),
     formula_(formula)
 {}
 
@@ -23,9 +24,92 @@ CDpllContext::CDpllContext(const SFormula& formula):
  */
 CDpllContext::CDpllContext(SFormula&& formula):
     assignment_(formula),
+    lookahead_(formula),
     formula_(std::move(formula))
 {}
 
+/**
+ * @param [in] formula SAT formula to rebuild context from
+ *
+ * Context becomes the same as the new one except for the decision
+ * strategy and the lookahead's limits, proof and limits are dropped.
+ */
+void CDpllContext::reset(const SFormula& formula)
+{
+    while (!state_stack_.empty())
+        state_stack_.pop();
+
+    proof_.reset();
+    limits_ = CLimits();
+    status_ = EStatus::UNKNOWN;
+
+    core_vec_.clear();
+    projection_vec_.clear();
+    projected_vec_.clear();
+    path_vec_.clear();
+    path_base_ = 0u;
+
+    assignment_.reset(formula);
+    formula_.reset(formula);
+    lookahead_.reset(formula);
+}
+
+/**
+ * @param [in] decision decision strategy
+ * @param [in] candidates_cnt count of the lookahead candidates at each node
+ * @param [in] node_budget count of the decision nodes with the lookahead
+ */
+void CDpllContext::set_decision(EDecision decision,
+                                size_t candidates_cnt, size_t node_budget)
+{
+    decision_ = decision;
+    lookahead_.set_limits(candidates_cnt, node_budget);
+}
+
+/**
+ * @param [in] params params to project solutions on, all if empty
+ *
+ * Projected params are decided before the others, so all of them
+ * are assigned above the first non-projected decision. Once solution
+ * is found next() drops the non-projected decisions and the rest
+ * of their subtree, so no two solutions have the same projection.
+ * Must be set before init() or solve().
+ */
+void CDpllContext::set_projection(const std::vector<int>& params)
+{
+    const size_t params_cnt = match().value_vec.size();
+
+    projection_vec_.clear();
+    projected_vec_.assign(params.empty() ? 0u : params_cnt, false);
+
+    for (int param : params)
+    {
+        [[unlikely]]
+        if (param <= 0 || static_cast<size_t>(param) > params_cnt)
+            throw CException("error: projected param is out of range");
+
+        if (!projected_vec_[param - 1])
+        {
+            projected_vec_[param - 1] = true;
+            projection_vec_.push_back(param);
+        }
+    }
+}
+
+/**
+ * @param [in] proof proof to write to or nullptr
+ *
+ * Every refuted subtree is recorded as the clause of the negated
+ * branch literals on its path, it is RUP given its children's clauses,
+ * which are deleted then. So the failed init() derives the empty clause
+ * and the failed solve() derives the negation of core().
+ * Proof is detached once any solution is found.
+ */
+void CDpllContext::set_proof(std::shared_ptr<CDpllProof> proof)
+{
+    proof_ = std::move(proof);
+}
+
 /**
  * @return true if any solution exists
  * @see next()
@@ -34,7 +118,7 @@ CDpllContext::CDpllContext(SFormula&& formula):
 bool CDpllContext::init()
 {
     state_stack_.push(SState {
-        .lit = assignment_.request(),
+        .lit = request(),
         .val = SMatch::EValue::TRUE,
         .assignment_state = assignment_.get_state(),
         .formula_state = formula_.get_state()
@@ -47,9 +131,19 @@ bool CDpllContext::init()
  * @return true if next solution exists
  * @see init()
  * @see search()
+ *
+ * Search interrupted by the limits is resumed from the same node.
  */
 bool CDpllContext::next()
 {
+    if (status_ == EStatus::UNKNOWN && !state_stack_.empty())
+        return search();
+
+    // other completions have the same projection
+    while (!projection_vec_.empty() && !state_stack_.empty() &&
+           !projected_vec_[std::abs(state_stack_.top().lit) - 1])
+        pop_state();
+
     if (!state_stack_.empty())
     {
         auto& top = state_stack_.top();
@@ -61,29 +155,162 @@ bool CDpllContext::next()
     return search();
 }
 
+/**
+ * @return generator yielding the assignment's match itself
+ * @see init()
+ * @see next()
+ *
+ * Yielded match is valid until the generator is resumed,
+ * so neither the context nor the match is copied per solution.
+ * Enumeration stops on the limits, status() tells if it is complete.
+ */
+CGenerator<const SMatch&> CDpllContext::models()
+{
+    for (bool found = init(); found; found = next())
+        co_yield match();
+}
+
+/**
+ * @param [in] clause clause over the existing params
+ *
+ * Decision tree is dropped, while the literals' priorities
+ * and the lookahead's budget are retained for the next solve().
+ * Clause's literals gain the priorities as if it was in the formula
+ * from the start, lookahead scores the live clauses at every node.
+ */
+void CDpllContext::add_clause(const std::vector<int>& clause)
+{
+    const size_t params_cnt = match().value_vec.size();
+    for (int lit : clause)
+    {
+        [[unlikely]]
+        if (lit == 0 || static_cast<size_t>(std::abs(lit)) > params_cnt)
+            throw CException("error: literal is out of range");
+    }
+
+    rewind();
+    formula_.add_clause(clause);
+    assignment_.add_clause(clause);
+}
+
+/**
+ * @param [in] assumptions literals to assign true to before the search
+ * @return true if solution under the assumptions exists
+ * @see core()
+ * @see next()
+ *
+ * Assumptions are propagated at the root, so next() enumerates
+ * the rest of solutions under the same assumptions.
+ * On failure core() holds the assumptions that weren't implied
+ * by the previous ones up to the failed one, or all of them if the
+ * search is exhausted, so the core isn't necessarily minimal.
+ * Search interrupted by the limits leaves the core empty
+ * and is resumed by next().
+ */
+bool CDpllContext::solve(const std::vector<int>& assumptions)
+{
+    const size_t params_cnt = match().value_vec.size();
+
+    rewind();
+    core_vec_.clear();
+
+    bool failed = false;
+    for (int lit : assumptions)
+    {
+        [[unlikely]]
+        if (lit == 0 || static_cast<size_t>(std::abs(lit)) > params_cnt)
+            throw CException("error: literal is out of range");
+
+        auto val = match().value_vec[std::abs(lit) - 1u];
+        if (val == SMatch::EValue::NONE)
+        {
+            core_vec_.push_back(lit);
+            failed = !propagate(lit);
+        }
+        else if ((val == SMatch::EValue::TRUE) != (lit > 0))
+        {
+            core_vec_.push_back(lit);
+            failed = true;
+        }
+
+        if (failed)
+            break;
+    }
+
+    // assumptions are the bottom of the path in the proof
+    path_vec_ = core_vec_;
+    path_base_ = path_vec_.size();
+
+    if (failed)
+    {
+        if (proof_ != nullptr)
+            derive(0);
+
+        status_ = EStatus::UNSAT;
+        rewind();
+        return false;
+    }
+
+    if (init() || status_ == EStatus::UNKNOWN)
+    {
+        core_vec_.clear();
+        return (status_ == EStatus::SAT);
+    }
+
+    rewind();
+    return false;
+}
+
 /**
  * @return true if search succedes
  * @see init()
  * @see next()
+ *
+ * Limits are polled at the start of each iteration,
+ * where assignment and formula correspond to the top state,
+ * so the interrupted search is resumed by the next call.
  */
 bool CDpllContext::search()
 {
     while (!state_stack_.empty())
     {
+        if (limits_.exhausted())
+        {
+            status_ = EStatus::UNKNOWN;
+            return false;
+        }
+
         auto& top = state_stack_.top();
 
+        // all params are assigned, the leaf may be the root itself
         if (top.lit == 0)
         {
-            state_stack_.pop();
-            break;
+            // subtrees above the model aren't refuted, the proof ends here
+            proof_.reset();
+
+            pop_state();
+            status_ = EStatus::SAT;
+            return true;
         }
 
         if (top.val == SMatch::EValue::NONE)
         {
-            assignment_.backtrack(top.assignment_state);
-            formula_.backtrack(top.formula_state);
+            if (proof_ != nullptr)
+            {
+                derive(0);
+                forget(-top.lit);
+                forget(top.lit);
+            }
+
+            pop_state();
+
+            // both branches are exhausted, rewind to the parent decision
+            if (!state_stack_.empty())
+            {
+                assignment_.backtrack(state_stack_.top().assignment_state);
+                formula_.backtrack(state_stack_.top().formula_state);
+            }
 
-            state_stack_.pop();
             continue;
         }
 
@@ -101,8 +328,10 @@ bool CDpllContext::search()
 
         if (propagate(prop_lit))
         {
+            limits_.on_decision();
+            path_vec_.push_back(prop_lit);
             state_stack_.push(SState {
-                .lit = assignment_.request(),
+                .lit = request(),
                 .val = SMatch::EValue::TRUE,
                 .assignment_state = assignment_.get_state(),
                 .formula_state = formula_.get_state()
@@ -110,12 +339,16 @@ bool CDpllContext::search()
         }
         else
         {
+            if (proof_ != nullptr)
+                derive(-prop_lit);
+
             assignment_.backtrack(top.assignment_state);
             formula_.backtrack(top.formula_state);
         }
     }
 
-    return !state_stack_.empty();
+    status_ = EStatus::UNSAT;
+    return false;
 }
 
 /**
@@ -126,6 +359,7 @@ bool CDpllContext::propagate(int lit)
 {
     while (lit != 0 && formula_.proceed(lit))
     {
+        limits_.on_propagation();
         assignment_.proceed(lit);
         lit = 0;
 
@@ -139,6 +373,86 @@ bool CDpllContext::propagate(int lit)
     return (lit == 0);
 }
 
+/**
+ * @return literal to branch on or 0 if all params are assigned
+ * @see CDpllLookahead::request()
+ */
+int CDpllContext::request()
+{
+    for (int param : projection_vec_)
+    {
+        if (match().value_vec[param - 1] == SMatch::EValue::NONE)
+            return param;
+    }
+
+    if (decision_ == EDecision::LOOKAHEAD)
+    {
+        if (int lit = lookahead_.request(formula_); lit != 0)
+            return lit;
+    }
+
+    return assignment_.request();
+}
+
+/**
+ * @see add_clause()
+ * @see solve()
+ */
+void CDpllContext::rewind()
+{
+    while (!state_stack_.empty())
+        state_stack_.pop();
+
+    path_vec_.clear();
+    path_base_ = 0u;
+
+    assignment_.backtrack(TAssignmentState { .log_idx = 0u });
+    formula_.backtrack(TFormulaState { .lit_log_idx = 0u, .cls_log_idx = 0u });
+}
+
+/**
+ * Branch of the new top is finished, so its literal leaves the path.
+ */
+void CDpllContext::pop_state()
+{
+    state_stack_.pop();
+
+    if (path_vec_.size() > path_base_)
+        path_vec_.pop_back();
+}
+
+/**
+ * @param [in] lit literal to append or 0
+ * @see forget()
+ */
+void CDpllContext::derive(int lit)
+{
+    proof_clause_vec_.clear();
+    for (int path_lit : path_vec_)
+        proof_clause_vec_.push_back(-path_lit);
+
+    if (lit != 0)
+        proof_clause_vec_.push_back(lit);
+
+    proof_->add(proof_clause_vec_);
+}
+
+/**
+ * @param [in] lit literal to append or 0
+ * @see derive()
+ */
+void CDpllContext::forget(int lit)
+{
+    proof_clause_vec_.clear();
+    for (int path_lit : path_vec_)
+        proof_clause_vec_.push_back(-path_lit);
+
+    if (lit != 0)
+        proof_clause_vec_.push_back(lit);
+
+    proof_->remove(proof_clause_vec_);
+}
+
 /**
  * @param [in] lhs
  * @param [in] rhs
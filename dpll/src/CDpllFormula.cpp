@@ -14,35 +14,51 @@ namespace tinysat {
  * @param [in] formula SAT formula's copy to copy CDpllFormula from
  */
 CDpllFormula::CDpllFormula(const SFormula& formula)
+{
+    reset(formula);
+}
+
+/**
+ * @param [in,out] formula SAT formula to move CDpllFormula from
+ */
+CDpllFormula::CDpllFormula(SFormula&& formula)
 {
     const size_t clauses_cnt = formula.clause_vec.size();
+    clauses_.reserve(clauses_cnt);
     for (size_t idx = 0u; idx < clauses_cnt; ++idx)
     {
         clauses_.push_back(SDpllClause { 
                 .idx = idx, 
                 .literals = SDpllClause::TContainer(
-                        formula.clause_vec[idx]) 
+                        encode(formula.clause_vec[idx])) 
             });
-
-        iter_map_.push_back(std::prev(std::end(clauses_)));
     }
 }
 
 /**
- * @param [in,out] formula SAT formula to move CDpllFormula from
+ * @param [in] formula SAT formula's copy to rebuild CDpllFormula from
  */
-CDpllFormula::CDpllFormula(SFormula&& formula)
+void CDpllFormula::reset(const SFormula& formula)
 {
+    stats_.unary_clause_set.clear();
+
+    while (!lit_log_stk_.empty())
+        lit_log_stk_.pop();
+
+    while (!cls_log_stk_.empty())
+        cls_log_stk_.pop();
+
+    clauses_.clear();
+
     const size_t clauses_cnt = formula.clause_vec.size();
+    clauses_.reserve(clauses_cnt);
     for (size_t idx = 0u; idx < clauses_cnt; ++idx)
     {
         clauses_.push_back(SDpllClause { 
                 .idx = idx, 
                 .literals = SDpllClause::TContainer(
-                        std::move(formula.clause_vec[idx])) 
+                        encode(formula.clause_vec[idx])) 
             });
-
-        iter_map_.push_back(std::prev(std::end(clauses_)));
     }
 }
 
@@ -84,12 +100,30 @@ void CDpllFormula::backtrack(const SState& state)
 
     while (state.lit_log_idx < lit_log_stk_.size())
     {
-        iter_map_[lit_log_stk_.top().idx]->literals
+        clauses_.at(lit_log_stk_.top().idx).literals
             .restore(std::move(lit_log_stk_.top().node));
         lit_log_stk_.pop();
     }
 }
 
+/**
+ * @param [in] clause clause to append
+ *
+ * Throws unless formula is backtracked to the initial state,
+ * as the logs must not refer to the clauses after the appended one.
+ */
+void CDpllFormula::add_clause(const std::vector<int>& clause)
+{
+    [[unlikely]]
+    if (!lit_log_stk_.empty() || !cls_log_stk_.empty())
+        throw CException("error: adding clause to the proceeded formula");
+
+    clauses_.push_back(SDpllClause { 
+            .idx = clauses_.size(), 
+            .literals = SDpllClause::TContainer(encode(clause)) 
+        });
+}
+
 // TODO:
 // - to store current assignment
 // - to check for lit to be already assigned
@@ -105,19 +139,22 @@ bool CDpllFormula::proceed(const int lit)
 
     stats_.unary_clause_set.erase(lit);
 
+    const auto pos_lit = SDpllLiteral::from_int(lit);
+    const auto neg_lit = ~pos_lit;
+
     auto cls_it = std::begin(clauses_);
     while (cls_it != std::end(clauses_))
     {
         auto lit_end = std::end(cls_it->literals);
         auto lit_it = lit_end;
 
-        if ((lit_it = cls_it->literals.find(lit)) != lit_end)
+        if ((lit_it = cls_it->literals.find(pos_lit)) != lit_end)
         {
             ++cls_it;
             cls_log_stk_.push(clauses_.extract(std::prev(cls_it)));
             continue;
         }
-        else if ((lit_it = cls_it->literals.find(-lit)) != lit_end)
+        else if ((lit_it = cls_it->literals.find(neg_lit)) != lit_end)
         {
             ++lit_it;
             lit_log_stk_.push(SLitLogEntry { 
@@ -133,7 +170,8 @@ bool CDpllFormula::proceed(const int lit)
         }
         else if (cls_it->literals.size() == 1u)
         {
-            stats_.unary_clause_set.insert(*std::begin(cls_it->literals));
+            stats_.unary_clause_set.insert(
+                    std::begin(cls_it->literals)->to_int());
         }
 
         ++cls_it;
@@ -142,4 +180,19 @@ bool CDpllFormula::proceed(const int lit)
     return result;
 }
 
+/**
+ * @param [in] clause clause's signed literals
+ * @return encoded literals
+ */
+std::vector<SDpllLiteral> CDpllFormula::encode(const std::vector<int>& clause)
+{
+    std::vector<SDpllLiteral> result;
+    result.reserve(clause.size());
+
+    for (int lit : clause)
+        result.push_back(SDpllLiteral::from_int(lit));
+
+    return result;
+}
+
 } // namespace tinysat
@@ -0,0 +1,179 @@
+#include "CDpllLookahead.hpp"
+
+#include <cmath>
+
+#include <algorithm>
+
+/**
+ * @file CDpllLookahead.cpp
+ * @author geome_try
+ * @date 2020
+ * @see CDpllLookahead.hpp
+ */
+
+/// @brief
+namespace tinysat {
+
+/**
+ * @param [in] formula formula to build heuristic for
+ * @param [in] candidates_cnt count of the candidates at each node
+ * @param [in] node_budget count of the nodes with the lookahead
+ */
+CDpllLookahead::CDpllLookahead(const SFormula& formula,
+                               size_t candidates_cnt,
+                               size_t node_budget):
+    candidates_cnt_(candidates_cnt),
+    node_budget_(node_budget),
+    budget_(node_budget)
+{
+    reset(formula);
+}
+
+/**
+ * @param [in] formula formula to rebuild heuristic for
+ *
+ * Candidates' count and the node budget are the ones set last,
+ * the budget spent on the previous formula is restored.
+ */
+void CDpllLookahead::reset(const SFormula& formula)
+{
+    params_cnt_ = formula.params_cnt;
+    budget_ = node_budget_;
+    score_vec_.assign(2u*params_cnt_, 0.0);
+    candidate_vec_.clear();
+    candidate_vec_.reserve(params_cnt_);
+}
+
+/**
+ * @param [in] candidates_cnt count of the candidates at each node
+ * @param [in] node_budget count of the nodes with the lookahead
+ */
+void CDpllLookahead::set_limits(size_t candidates_cnt, 
+                                size_t node_budget) noexcept
+{
+    candidates_cnt_ = candidates_cnt;
+    node_budget_ = node_budget;
+    budget_ = node_budget;
+}
+
+/**
+ * @param [in, out] formula formula to look ahead on, restored on return
+ * @return branching literal or 0 if budget is exhausted or no candidates
+ *
+ * Formula must have no pending unit clauses.
+ */
+int CDpllLookahead::request(CDpllFormula& formula)
+{
+    if (budget_ == 0u || candidates_cnt_ == 0u)
+        return 0;
+
+    --budget_;
+
+    preselect(formula);
+
+    int best_lit = 0;
+    size_t best_mix = 0u;
+
+    for (int param : candidate_vec_)
+    {
+        size_t pos_red = 0u;
+        size_t neg_red = 0u;
+
+        bool pos_ok = probe(formula, +param, pos_red);
+        bool neg_ok = probe(formula, -param, neg_red);
+
+        // failed literal, the other branch is refuted at once
+        if (!pos_ok)
+            return -param;
+
+        if (!neg_ok)
+            return +param;
+
+        size_t mix = MIX_FACTOR*pos_red*neg_red + pos_red + neg_red;
+        if (best_lit == 0 || best_mix < mix)
+        {
+            // less reduced branch first as more likely satisfiable
+            best_lit = (pos_red <= neg_red ? +param : -param);
+            best_mix = mix;
+        }
+    }
+
+    return best_lit;
+}
+
+/**
+ * @param [in] formula formula to score params in
+ *
+ * Diff score of the literal is the sum of 2^-|C| over clauses C with it,
+ * params are ranked by the product of their literals' scores.
+ */
+void CDpllLookahead::preselect(const CDpllFormula& formula)
+{
+    std::fill(std::begin(score_vec_), std::end(score_vec_), 0.0);
+
+    for (const auto& clause : formula.clauses())
+    {
+        double weight = std::ldexp(1.0, 
+                -static_cast<int>(std::min<size_t>(clause.literals.size(), 
+                                                   64u)));
+
+        for (auto lit : clause.literals)
+            score_vec_[lit.idx()] += weight;
+    }
+
+    auto rank = [this] (int param)
+    {
+        double pos = score_vec_[lit2idx(+param)];
+        double neg = score_vec_[lit2idx(-param)];
+
+        return MIX_FACTOR*pos*neg + pos + neg;
+    };
+
+    candidate_vec_.clear();
+    for (size_t idx = 0u; idx < params_cnt_; ++idx)
+    {
+        int param = static_cast<int>(idx + 1u);
+        if (score_vec_[lit2idx(+param)] + score_vec_[lit2idx(-param)] > 0.0)
+            candidate_vec_.push_back(param);
+    }
+
+    if (candidate_vec_.size() > candidates_cnt_)
+    {
+        auto mid = std::next(std::begin(candidate_vec_), candidates_cnt_);
+        std::nth_element(std::begin(candidate_vec_), mid,
+                         std::end(candidate_vec_),
+                         [&rank] (int lhs, int rhs) 
+                         { return rank(lhs) > rank(rhs); });
+
+        candidate_vec_.erase(mid, std::end(candidate_vec_));
+    }
+}
+
+/**
+ * @param [in, out] formula formula to propagate on, restored on return
+ * @param [in] lit literal to assign true to
+ * @param [out] reduction count of the literals removed from the clauses
+ * @return true if propagation doesn't imply conflicts
+ */
+bool CDpllLookahead::probe(CDpllFormula& formula, int lit, size_t& reduction)
+{
+    auto state = formula.get_state();
+
+    while (lit != 0 && formula.proceed(lit))
+    {
+        lit = 0;
+
+        if (auto prop_it = std::begin(formula.stats().unary_clause_set); 
+            prop_it != std::end(formula.stats().unary_clause_set))
+        {
+            lit = *prop_it;
+        }
+    }
+
+    reduction = formula.get_state().lit_log_idx - state.lit_log_idx;
+    formula.backtrack(state);
+
+    return (lit == 0);
+}
+
+} // namespace tinysat
@@ -0,0 +1,184 @@
+#include "CDpllProof.hpp"
+
+#include <cstdlib>
+
+#include <charconv>
+
+/**
+ * @file CDpllProof.cpp
+ * @author geome_try
+ * @date 2020
+ * @see CDpllProof.hpp
+ */
+
+/// @brief
+namespace tinysat {
+
+/**
+ * @param [in] stream output stream, must outlive the proof
+ * @param [in] format output format
+ * @param [in] buffer_size size of the buffer handed to the writer
+ */
+CDpllProof::CDpllProof(std::ostream& stream, EFormat format,
+                       size_t buffer_size):
+    stream_(stream),
+    format_(format),
+    buffer_size_(buffer_size),
+    buffer_(),
+    pending_deq_(),
+    free_vec_(),
+    writer_()
+{
+    buffer_.reserve(buffer_size_);
+    writer_ = std::thread(&CDpllProof::work, this);
+}
+
+CDpllProof::~CDpllProof()
+{
+    flush();
+
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+
+    pending_cv_.notify_all();
+    writer_.join();
+}
+
+/**
+ * @param [in] clause derived clause
+ * @see remove()
+ */
+void CDpllProof::add(const std::vector<int>& clause)
+{
+    encode('a', clause);
+}
+
+/**
+ * @param [in] clause deleted clause
+ * @see add()
+ */
+void CDpllProof::remove(const std::vector<int>& clause)
+{
+    encode('d', clause);
+}
+
+/**
+ * Blocks until the writer outputs all the submitted buffers.
+ */
+void CDpllProof::flush()
+{
+    if (!buffer_.empty())
+        submit();
+
+    std::unique_lock lock(mutex_);
+    done_cv_.wait(lock, [this]
+                  { return pending_deq_.empty() && !writing_; });
+
+    stream_.flush();
+}
+
+/**
+ * @param [in] prefix 'a' for the addition or 'd' for the deletion
+ * @param [in] clause clause to encode
+ */
+void CDpllProof::encode(char prefix, const std::vector<int>& clause)
+{
+    if (format_ == EFormat::BINARY)
+    {
+        buffer_.push_back(prefix);
+        for (int lit : clause)
+        {
+            auto code = 2u*static_cast<unsigned>(std::abs(lit)) + (lit < 0);
+            for (; code >= 0x80u; code >>= 7u)
+                buffer_.push_back(static_cast<char>(0x80u | (code & 0x7Fu)));
+
+            buffer_.push_back(static_cast<char>(code));
+        }
+
+        buffer_.push_back(0);
+    }
+    else
+    {
+        if (prefix == 'd')
+        {
+            buffer_.push_back('d');
+            buffer_.push_back(' ');
+        }
+
+        // sign and 10 digits of int
+        char digits[16u];
+        for (int lit : clause)
+        {
+            auto [end, err] = std::to_chars(digits, digits + sizeof(digits),
+                                            lit);
+            buffer_.insert(std::end(buffer_), digits, end);
+            buffer_.push_back(' ');
+        }
+
+        buffer_.push_back('0');
+        buffer_.push_back('\n');
+    }
+
+    if (buffer_.size() >= buffer_size_)
+        submit();
+}
+
+/**
+ * Waits if MAX_PENDING buffers are already submitted.
+ */
+void CDpllProof::submit()
+{
+    std::unique_lock lock(mutex_);
+    done_cv_.wait(lock, [this]
+                  { return pending_deq_.size() < MAX_PENDING; });
+
+    pending_deq_.push_back(std::move(buffer_));
+
+    if (free_vec_.empty())
+    {
+        buffer_ = std::vector<char>();
+        buffer_.reserve(buffer_size_);
+    }
+    else
+    {
+        buffer_ = std::move(free_vec_.back());
+        free_vec_.pop_back();
+    }
+
+    lock.unlock();
+    pending_cv_.notify_one();
+}
+
+/**
+ * Outputs buffers without holding the lock and recycles them.
+ */
+void CDpllProof::work()
+{
+    std::unique_lock lock(mutex_);
+    while (true)
+    {
+        pending_cv_.wait(lock, [this]
+                         { return stop_ || !pending_deq_.empty(); });
+
+        if (pending_deq_.empty())
+            break;
+
+        std::vector<char> buffer = std::move(pending_deq_.front());
+        pending_deq_.pop_front();
+        writing_ = true;
+
+        lock.unlock();
+        stream_.write(buffer.data(),
+                      static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        lock.lock();
+
+        writing_ = false;
+        free_vec_.push_back(std::move(buffer));
+        done_cv_.notify_all();
+    }
+}
+
+} // namespace tinysat
@@ -0,0 +1,231 @@
+#include "CDpllProofChecker.hpp"
+
+#include <cstdlib>
+
+#include <algorithm>
+
+/**
+ * @file CDpllProofChecker.cpp
+ * @author geome_try
+ * @date 2020
+ * @see CDpllProofChecker.hpp
+ */
+
+/// @brief
+namespace tinysat {
+
+/**
+ * @param [in] formula formula the proof refutes
+ */
+CDpllProofChecker::CDpllProofChecker(const SFormula& formula):
+    params_cnt_(formula.params_cnt),
+    lemma_cnt_(0u),
+    clause_vec_(),
+    alive_vec_(),
+    index_map_(),
+    match_()
+{
+    match_.value_vec.assign(params_cnt_, SMatch::EValue::NONE);
+
+    for (const auto& clause : formula.clause_vec)
+        insert(std::vector<int>(std::begin(clause), std::end(clause)));
+}
+
+/**
+ * @param [in, out] stream stream with the proof
+ * @param [in] format proof format
+ * @return true if every addition is RUP and the empty clause is derived
+ */
+bool CDpllProofChecker::check(std::istream& stream, EFormat format)
+{
+    char prefix = 'a';
+    std::vector<int> clause;
+
+    while (read(stream, format, prefix, clause))
+    {
+        for (int lit : clause)
+        {
+            if (lit == 0 || static_cast<size_t>(std::abs(lit)) > params_cnt_)
+                return false;
+        }
+
+        if (prefix == 'd')
+        {
+            std::sort(std::begin(clause), std::end(clause));
+
+            // deletion of the missing clause is ignored like in drat-trim
+            auto index_it = index_map_.find(clause);
+            if (index_it != std::end(index_map_) && !index_it->second.empty())
+            {
+                alive_vec_[index_it->second.back()] = false;
+                index_it->second.pop_back();
+            }
+
+            continue;
+        }
+
+        ++lemma_cnt_;
+        if (!is_rup(clause))
+            return false;
+
+        if (clause.empty())
+            return true;
+
+        insert(std::move(clause));
+    }
+
+    return false;
+}
+
+/**
+ * @param [in, out] stream stream with the proof
+ * @param [in] format proof format
+ * @param [out] prefix 'a' for the addition or 'd' for the deletion
+ * @param [out] clause clause's literals
+ * @return false if the stream has ended or clause is malformed
+ */
+bool CDpllProofChecker::read(std::istream& stream, EFormat format,
+                             char& prefix, std::vector<int>& clause) const
+{
+    clause.clear();
+
+    if (format == EFormat::BINARY)
+    {
+        int byte = stream.get();
+        if (byte != 'a' && byte != 'd')
+            return false;
+
+        prefix = static_cast<char>(byte);
+        while (true)
+        {
+            unsigned code = 0u;
+            for (unsigned shift = 0u; ; shift += 7u)
+            {
+                byte = stream.get();
+                if (byte == std::char_traits<char>::eof() || shift > 28u)
+                    return false;
+
+                code |= (static_cast<unsigned>(byte) & 0x7Fu) << shift;
+                if ((byte & 0x80) == 0)
+                    break;
+            }
+
+            if (code == 0u)
+                return true;
+
+            int param = static_cast<int>(code >> 1u);
+            clause.push_back(code & 1u ? -param : param);
+        }
+    }
+
+    prefix = 'a';
+    stream >> std::ws;
+    if (stream.peek() == 'd')
+    {
+        prefix = 'd';
+        stream.get();
+    }
+
+    int lit = 0;
+    while (stream >> lit)
+    {
+        if (lit == 0)
+            return true;
+
+        clause.push_back(lit);
+    }
+
+    return false;
+}
+
+/**
+ * @param [in] clause clause to check
+ * @return true if propagation of the negated clause reaches a conflict
+ */
+bool CDpllProofChecker::is_rup(const std::vector<int>& clause)
+{
+    auto& value_vec = match_.value_vec;
+    std::fill(std::begin(value_vec), std::end(value_vec),
+              SMatch::EValue::NONE);
+
+    auto lit_value = [&value_vec] (int lit)
+    {
+        auto value = value_vec[std::abs(lit) - 1];
+        if (value == SMatch::EValue::NONE || lit > 0)
+            return value;
+
+        return (value == SMatch::EValue::TRUE ? SMatch::EValue::FALSE :
+                                                SMatch::EValue::TRUE);
+    };
+
+    auto assign = [&value_vec] (int lit)
+    {
+        value_vec[std::abs(lit) - 1] =
+            (lit > 0 ? SMatch::EValue::TRUE : SMatch::EValue::FALSE);
+    };
+
+    for (int lit : clause)
+    {
+        // tautology is implied trivially
+        if (lit_value(lit) == SMatch::EValue::TRUE)
+            return true;
+
+        assign(-lit);
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t idx = 0u; idx < clause_vec_.size(); ++idx)
+        {
+            if (!alive_vec_[idx])
+                continue;
+
+            int free_lit = 0;
+            size_t free_cnt = 0u;
+            bool satisfied = false;
+
+            for (int lit : clause_vec_[idx])
+            {
+                auto value = lit_value(lit);
+                if (value == SMatch::EValue::TRUE)
+                {
+                    satisfied = true;
+                    break;
+                }
+
+                if (value == SMatch::EValue::NONE)
+                {
+                    free_lit = lit;
+                    ++free_cnt;
+                }
+            }
+
+            if (satisfied || free_cnt > 1u)
+                continue;
+
+            if (free_cnt == 0u)
+                return true;
+
+            assign(free_lit);
+            changed = true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @param [in] clause clause to append
+ */
+void CDpllProofChecker::insert(std::vector<int> clause)
+{
+    std::sort(std::begin(clause), std::end(clause));
+
+    index_map_[clause].push_back(clause_vec_.size());
+    alive_vec_.push_back(true);
+    clause_vec_.push_back(std::move(clause));
+}
+
+} // namespace tinysat
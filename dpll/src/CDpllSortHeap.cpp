@@ -13,24 +13,35 @@ namespace tinysat {
 /**
  * @param [in] formula formula to build heap from
  */
-CDpllSortHeap::CDpllSortHeap(const SFormula& formula):
-    lit_cnt_{ 2u*formula.params_cnt },
-    size_{ lit_cnt_ },
-    prior_sum_{ 0.0 },
-    prior_vec_(lit_cnt_, 0.0),
-    heap_vec_(1u + lit_cnt_, 0),
-    heap_map_(lit_cnt_, 0u)
+CDpllSortHeap::CDpllSortHeap(const SFormula& formula)
 {
-    int max_lit = static_cast<int>(formula.params_cnt);
-    for (int lit = 1; lit <= max_lit; ++lit)
-    {
-        heap_vec_[lit2idx(lit) + 1u] = lit;
-        heap_map_[lit2idx(lit)] = lit2idx(lit) + 1u;
+    reset(formula);
+}
+
+/**
+ * @param [in] formula formula to rebuild heap from
+ */
+void CDpllSortHeap::reset(const SFormula& formula)
+{
+    lit_cnt_ = 2u*formula.params_cnt;
+    size_ = lit_cnt_;
+    prior_sum_ = 0.0;
+    occ_prior_ = 1.0;
+    prior_vec_.assign(lit_cnt_, 1.0);
+    heap_vec_.assign(1u + lit_cnt_, SDpllLiteral { .code = 0u });
+    heap_map_.assign(lit_cnt_, 0u);
 
-        heap_vec_[lit2idx(-lit) + 1u] = -lit;
-        heap_map_[lit2idx(-lit)] = lit2idx(-lit) + 1u;
+    for (size_t idx = 0u; idx < lit_cnt_; ++idx)
+    {
+        heap_vec_[idx + 1u] = SDpllLiteral { 
+            .code = static_cast<SDpllLiteral::TCode>(idx) 
+        };
+        heap_map_[idx] = idx + 1u;
     }
 
+    // every literal starts with a unit priority
+    // to keep the sign of the priority meaningful
+    prior_sum_ = static_cast<double>(lit_cnt_);
     for (const auto& clause : formula.clause_vec)
     {
         prior_sum_ += static_cast<double>(clause.size());
@@ -49,7 +60,7 @@ CDpllSortHeap::CDpllSortHeap(const SFormula& formula):
  */
 int CDpllSortHeap::get() const
 {
-    return heap_vec_[1u];
+    return heap_vec_[1u].to_int();
 }
 
 /**
@@ -59,11 +70,13 @@ int CDpllSortHeap::get() const
  */
 int CDpllSortHeap::extract(const int lit)
 {
-    [[unlikely]] if (prior_vec_[lit2idx(lit)] < 0.0)
+    const size_t idx = lit2idx(lit);
+
+    [[unlikely]] if (prior_vec_[idx] < 0.0)
         return 0;
 
-    size_t it = heap_map_[lit2idx(lit)];
-    prior_vec_[lit2idx(lit)] = abs(prior_vec_[lit2idx(lit)]) * -1.0;
+    size_t it = heap_map_[idx];
+    prior_vec_[idx] = std::abs(prior_vec_[idx]) * -1.0;
 
     size_t old_it = it;
     while ((it = sift_dn(old_it)) != old_it)
@@ -81,11 +94,13 @@ int CDpllSortHeap::extract(const int lit)
  */
 int CDpllSortHeap::restore(const int lit)
 {
-    [[unlikely]] if (prior_vec_[lit2idx(lit)] > 0.0)
+    const size_t idx = lit2idx(lit);
+
+    [[unlikely]] if (prior_vec_[idx] > 0.0)
         return 0;
 
-    size_t it = heap_map_[lit2idx(lit)];
-    prior_vec_[lit2idx(lit)] = abs(prior_vec_[lit2idx(lit)]);
+    size_t it = heap_map_[idx];
+    prior_vec_[idx] = std::abs(prior_vec_[idx]);
 
     size_t old_it = it;
     while ((it = sift_up(old_it)) != old_it)
@@ -109,18 +124,52 @@ double CDpllSortHeap::get_prior(int lit) const
 /**
  * @param [in] lit literal to decrease its priority
  * @see get_prior()
+ * @see inc_prior()
  */
 void CDpllSortHeap::dec_prior(int lit)
 {
-    prior_sum_ -= std::abs(prior_vec_[lit2idx(lit)]);
-    prior_vec_[lit2idx(lit)] *= DEC_FACTOR;
-    prior_sum_ += std::abs(prior_vec_[lit2idx(lit)]);
+    const size_t idx = lit2idx(lit);
+
+    prior_sum_ -= std::abs(prior_vec_[idx]);
+    prior_vec_[idx] *= DEC_FACTOR;
+    prior_sum_ += std::abs(prior_vec_[idx]);
 
-    size_t it = heap_map_[lit2idx(lit)];
+    // extracted literals grow towards zero, active ones decrease
+    size_t it = heap_map_[idx];
     size_t old_it = it;
     while ((it = sift_up(old_it)) != old_it)
         old_it = it;
 
+    while ((it = sift_dn(old_it)) != old_it)
+        old_it = it;
+
+    if (prior_sum_ < 1.0/BALANCE_SUM || BALANCE_SUM < prior_sum_)
+        balance();
+}
+
+/**
+ * @param [in] lit literal of the new clause
+ * @see dec_prior()
+ *
+ * Occurrence weighs as much as the ones counted by reset()
+ * after all the balancings since then.
+ */
+void CDpllSortHeap::inc_prior(int lit)
+{
+    const size_t idx = lit2idx(lit);
+
+    prior_sum_ += occ_prior_;
+    prior_vec_[idx] += (prior_vec_[idx] < 0.0 ? -occ_prior_ : occ_prior_);
+
+    // extracted literals move away from zero, active ones grow
+    size_t it = heap_map_[idx];
+    size_t old_it = it;
+    while ((it = sift_up(old_it)) != old_it)
+        old_it = it;
+
+    while ((it = sift_dn(old_it)) != old_it)
+        old_it = it;
+
     if (prior_sum_ < 1.0/BALANCE_SUM || BALANCE_SUM < prior_sum_)
         balance();
 }
@@ -137,10 +186,10 @@ size_t CDpllSortHeap::sift_up(size_t it)
     auto& cur_lit = heap_vec_[it];
     auto& up_lit = heap_vec_[it/2u];
 
-    if (prior_vec_[lit2idx(up_lit)] < prior_vec_[lit2idx(cur_lit)])
+    if (prior_vec_[up_lit.idx()] < prior_vec_[cur_lit.idx()])
     {
         std::swap(cur_lit, up_lit);
-        std::swap(heap_map_[lit2idx(cur_lit)], heap_map_[lit2idx(up_lit)]);
+        std::swap(heap_map_[cur_lit.idx()], heap_map_[up_lit.idx()]);
 
         it /= 2u;
     }
@@ -154,27 +203,41 @@ size_t CDpllSortHeap::sift_up(size_t it)
  */
 size_t CDpllSortHeap::sift_dn(size_t it)
 {
-    if (heap_vec_.size() < 2u*(it + 1u))
+    if (heap_vec_.size() <= 2u*it)
         return it;
 
     auto& cur_lit = heap_vec_[it];
     auto& lt_lit = heap_vec_[2u*it + 0u];
+
+    if (heap_vec_.size() == 2u*it + 1u)
+    {
+        if (prior_vec_[cur_lit.idx()] < prior_vec_[lt_lit.idx()])
+        {
+            std::swap(cur_lit, lt_lit);
+            std::swap(heap_map_[cur_lit.idx()], heap_map_[lt_lit.idx()]);
+
+            it = 2u*it + 0u;
+        }
+
+        return it;
+    }
+
     auto& rt_lit = heap_vec_[2u*it + 1u];
 
-    if (prior_vec_[lit2idx(cur_lit)] < 
-        std::max(prior_vec_[lit2idx(lt_lit)], prior_vec_[lit2idx(rt_lit)]))
+    if (prior_vec_[cur_lit.idx()] < 
+        std::max(prior_vec_[lt_lit.idx()], prior_vec_[rt_lit.idx()]))
     {
-        if (prior_vec_[lit2idx(lt_lit)] < prior_vec_[lit2idx(rt_lit)])
+        if (prior_vec_[lt_lit.idx()] < prior_vec_[rt_lit.idx()])
         {
             std::swap(cur_lit, rt_lit);
-            std::swap(heap_map_[lit2idx(cur_lit)], heap_map_[lit2idx(rt_lit)]);
+            std::swap(heap_map_[cur_lit.idx()], heap_map_[rt_lit.idx()]);
 
             it = 2u*it + 1u;
         }
         else
         {
             std::swap(cur_lit, lt_lit);
-            std::swap(heap_map_[lit2idx(cur_lit)], heap_map_[lit2idx(lt_lit)]);
+            std::swap(heap_map_[cur_lit.idx()], heap_map_[lt_lit.idx()]);
 
             it = 2u*it + 0u;
         }
@@ -188,8 +251,12 @@ size_t CDpllSortHeap::sift_dn(size_t it)
  */
 void CDpllSortHeap::heapify()
 {
-    for (size_t it = lit_cnt_; it != 0u; --it)
-        sift_up(it);
+    for (size_t it = lit_cnt_/2u; it != 0u; --it)
+    {
+        size_t cur_it = it, old_it = it;
+        while ((cur_it = sift_dn(old_it)) != old_it)
+            old_it = cur_it;
+    }
 }
 
 /**
@@ -199,9 +266,10 @@ void CDpllSortHeap::balance()
 {
     double factor = BALANCE_SUM/prior_sum_;
 
+    occ_prior_ *= factor;
     prior_sum_ = 0.0;
     for (size_t idx = 0u; idx < lit_cnt_; ++idx)
-        prior_sum_ += (prior_vec_[lit_cnt_ - 1u - idx] *= factor);
+        prior_sum_ += std::abs(prior_vec_[lit_cnt_ - 1u - idx] *= factor);
 }
 
 /**
@@ -214,7 +282,7 @@ bool CDpllSortHeap::ok() const noexcept
     result = result && 
         (1.0 / BALANCE_SUM < prior_sum_) &&
         (prior_sum_ < BALANCE_SUM) &&
-        (lit_cnt_ == heap_vec_.size() + 1u) &&
+        (lit_cnt_ + 1u == heap_vec_.size()) &&
         (lit_cnt_ == heap_map_.size()) &&
         (lit_cnt_ == prior_vec_.size());
 
@@ -237,10 +305,10 @@ bool CDpllSortHeap::dump(TStream& stream) const noexcept
              cur_idx < cur_max && beg_idx + cur_idx <= lit_cnt_; 
              ++cur_idx)
         {
-            int lit = heap_vec_[beg_idx + cur_idx];
+            auto lit = heap_vec_[beg_idx + cur_idx];
             stream << 
-                "(" << lit << 
-                "," << prior_vec_[lit2idx(lit)] << 
+                "(" << lit.to_int() << 
+                "," << prior_vec_[lit.idx()] << 
                 ") ";
         }
 
@@ -0,0 +1,68 @@
+#ifndef TINYSAT_CBATCHSOLVER_HPP_
+#define TINYSAT_CBATCHSOLVER_HPP_
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "CException.hpp"
+#include "CThreadPool.hpp"
+#include "SFormula.hpp"
+#include "SMatch.hpp"
+
+#include "include/CDpllContext.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Solver for batches of independent formulas
+class CBatchSolver;
+
+/**
+ * Holds persistent thread pool and DPLL context per worker.
+ * Contexts are reset for every formula so their memory is reused.
+ */
+class CBatchSolver
+{
+public:
+    using result_t = std::optional<SMatch>; ///< First model or nothing
+
+    /// Ctor from the workers' count
+    explicit CBatchSolver(size_t workers_cnt =
+                          std::thread::hardware_concurrency());
+
+    CBatchSolver             (const CBatchSolver&) = delete; ///< Rule of 5
+    CBatchSolver& operator = (const CBatchSolver&) = delete; ///< Rule of 5
+    CBatchSolver             (CBatchSolver&&) = delete; ///< Rule of 5
+    CBatchSolver& operator = (CBatchSolver&&) = delete; ///< Rule of 5
+
+    /// Returns workers' count
+    /**
+     * @return workers' count
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return thread_pool_->size();
+    }
+
+    /// Solve formulas returning results in the input order
+    [[nodiscard]] std::vector<result_t> solve(std::span<const SFormula>);
+
+    /// Solve formulas writing results in the input order
+    void solve(std::span<const SFormula>, std::span<result_t>);
+
+private:
+    std::unique_ptr<CThreadPool> thread_pool_;
+    std::vector<CDpllContext> context_vec_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CBATCHSOLVER_HPP_
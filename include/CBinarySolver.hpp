@@ -1,21 +1,34 @@
 #ifndef TINYSAT_CBINARYSOLVER_HPP_
 #define TINYSAT_CBINARYSOLVER_HPP_
 
+#include <cstdint>
+#include <cstdlib>
+
 #include <vector>
-#include <set>
 #include <memory>
 
 #include "CMatchIterator.hpp"
 #include "CException.hpp"
 #include "SFormula.hpp"
-#include "CGraph.hpp"
+#include "CCsrGraph.hpp"
 
 namespace tinysat {
 
 // SAT solver implementing a 2-SAT algorithm
 //
+// All the models are enumerated by the backtracking over the condensation:
+// propagation of a literal without conflict keeps 2-SAT satisfiable,
+// so every branch leads to a model and the delay is polynomial.
+// Decisions follow the maintained model first, so the first model
+// is found without conflicts, next ones rewind only the changed suffix.
+//
+// Clauses may be added incrementally: the maintained model is repaired
+// by flipping the implication closure of a literal of the violated clause,
+// new implications are kept as the delta edges over the condensation.
+// The condensation is rebuilt only when the delta outgrows it.
+// Adding a clause invalidates the live contexts.
+//
 // TODO:
-// - To search for multiple solutions
 // - To imlement LegasySolver concept
 //
 class CBinarySolver
@@ -35,6 +48,9 @@ public:
     void reset(const SFormula&);
     void reset(SFormula&&);
 
+    // returns whether the formula is still satisfiable
+    bool add_clause(const std::vector<int32_t>& clause);
+
     [[nodiscard]] std::unique_ptr<CContext> context() const;
     void proceed(std::unique_ptr<CContext>&) const;
 
@@ -43,13 +59,69 @@ public:
 
 protected:
     void init();
-    void set_match(CContext&) const;
+
+    // literal vertex: param for TRUE, param + params_cnt for FALSE
+    [[nodiscard]] size_t lit_comp(size_t param, bool value) const noexcept
+    {
+        return comp_vec_[value ? param : param + formula_.params_cnt];
+    }
+
+    [[nodiscard]] size_t lit_comp(int32_t literal) const noexcept
+    {
+        return (literal > 0 ? lit_comp(literal - 1, true) :
+                              lit_comp(-literal - 1, false));
+    }
+
+    // value of the param in the maintained model
+    [[nodiscard]] bool model_value(size_t param) const noexcept
+    {
+        return comp_model_vec_[lit_comp(param, true)];
+    }
+
+    template<typename FFunc>
+    void visit_edges(size_t comp, FFunc&& func) const
+    {
+        for (size_t next : comp_graph_.edges(comp))
+            func(next);
+
+        if (!delta_adj_vec_.empty())
+        {
+            for (size_t next : delta_adj_vec_[comp])
+                func(next);
+        }
+    }
+
+    bool repair(size_t comp);
+
+    bool assign(CContext&, size_t comp) const;
+    void rewind(CContext&, size_t trail_size) const;
+    void descend(CContext&, size_t param) const;
+    bool backtrack(CContext&) const;
 
 private:
     SFormula formula_;
+    bool satisfiable_ = false;
 
     std::vector<size_t> comp_vec_;
-    CGraph<std::set> comp_graph_;
+    CCsrGraph comp_graph_;
+
+    std::vector<size_t> neg_comp_vec_;
+
+    // literal vertices of every component in the CSR form
+    std::vector<size_t> memb_off_vec_;
+    std::vector<size_t> memb_vec_;
+
+    // implications added after the last rebuild
+    std::vector<std::vector<size_t>> delta_adj_vec_;
+    size_t delta_cnt_ = 0u;
+
+    std::vector<bool> comp_model_vec_;
+
+    // scratch of the repair: flipped components and visit stamps
+    std::vector<size_t> flip_vec_;
+    std::vector<size_t> stack_vec_;
+    std::vector<uint64_t> stamp_vec_;
+    uint64_t stamp_ = 0u;
 };
 
 // Context incapsulating data for the CBinarySolver algorithm
@@ -62,8 +134,7 @@ class CBinarySolver::CContext
 public:
     friend class CBinarySolver;
 
-    explicit CContext(const std::vector<size_t>& order_vec);
-    explicit CContext(std::vector<size_t>&& order_vec);
+    CContext(size_t params_cnt, size_t comp_cnt);
 
     CContext             (const CContext&) = default;
     CContext& operator = (const CContext&) = default;
@@ -77,8 +148,19 @@ public:
     friend bool operator != (const CContext& lhs, const CContext& rhs);
 
 private:
+    struct SDecision
+    {
+        size_t param;
+        size_t trail_size;
+        bool flipped;
+    };
+
     SMatch match_;
-    std::vector<size_t> order_vec_;
+
+    std::vector<SMatch::EValue> comp_value_vec_;
+    std::vector<size_t> trail_vec_; // components assigned TRUE
+    std::vector<size_t> queue_vec_; // propagation scratch
+    std::vector<SDecision> decision_vec_;
 };
 
 } // namespace tinysat 
@@ -0,0 +1,141 @@
+#ifndef TINYSAT_CCOUNTSOLVER_HPP_
+#define TINYSAT_CCOUNTSOLVER_HPP_
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <unordered_map>
+#include <vector>
+
+#include "CBigUint.hpp"
+#include "CException.hpp"
+#include "SFormula.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Model counting (#SAT) solver
+class CCountSolver;
+
+/**
+ * Counts models by the DPLL with the component decomposition.
+ * After every decision and unit propagation the residual formula
+ * is split into the components not sharing free params,
+ * their counts are multiplied and the free params not occurring
+ * in the residual clauses double the count.
+ *
+ * Component is identified by its sorted free params and clauses,
+ * which determine the residual clauses, so the counts of components
+ * met again in the other branches are taken from the cache.
+ * Cache is cleared when it exceeds its entries' limit.
+ */
+class CCountSolver
+{
+public:
+    /// Index type of the params and clauses
+    using TIndex = uint32_t;
+
+    /// Default limit of the cached components
+    static constexpr size_t DEFAULT_CACHE_LIMIT = 1u << 20u;
+
+    /// Counters of the search
+    struct SStats
+    {
+        uint64_t decisions; ///< Count of the branchings
+        uint64_t components; ///< Count of the components met
+        uint64_t cache_hits; ///< Count of the components found in cache
+    };
+
+    /// Ctor from SAT formula and cache limit
+    explicit CCountSolver(const SFormula&,
+                          size_t cache_limit = DEFAULT_CACHE_LIMIT);
+
+    CCountSolver             (CCountSolver&&) = default; ///< Move ctor
+    CCountSolver& operator = (CCountSolver&&) = default; ///< Move operator
+
+    /// Count models of the formula
+    [[nodiscard]] CBigUint count();
+
+    /// Get counters of the last count()
+    /**
+     * @return search counters
+     */
+    [[nodiscard]] const SStats& stats() const noexcept
+    {
+        return stats_;
+    }
+
+protected:
+    /// Component as sorted free params and unsatisfied clauses
+    struct SComponent
+    {
+        std::vector<TIndex> param_vec; ///< free params
+        std::vector<TIndex> cls_vec; ///< unsatisfied clauses
+    };
+
+    /// Hash of the component's key
+    struct SKeyHash
+    {
+        /// FNV-1a over the key's words
+        size_t operator () (const std::vector<TIndex>&) const noexcept;
+    };
+
+    /// Build clause and occurrence lists
+    void init(const SFormula&);
+
+    /// Assign true to the literal and propagate the unit clauses
+    [[nodiscard]] bool propagate(TIndex lit);
+
+    /// Unassign params assigned after the given trail size
+    void rewind(size_t trail_size);
+
+    /// Split free params of the component into components
+    size_t decompose(const std::vector<TIndex>& param_vec,
+                     std::vector<SComponent>& comp_vec);
+
+    /// Count models of the residual formula over the component's params
+    [[nodiscard]] CBigUint count_residual(const std::vector<TIndex>&);
+
+    /// Count models of the connected component
+    [[nodiscard]] CBigUint count_component(const SComponent&);
+
+    /// Check clause for being satisfied
+    [[nodiscard]] bool is_satisfied(TIndex cls) const noexcept;
+
+private:
+    size_t params_cnt_ = 0u;
+    size_t cache_limit_ = DEFAULT_CACHE_LIMIT;
+    bool has_empty_ = false;
+
+    SStats stats_ = {};
+
+    // literal is 2*param + 1 for negative
+    std::vector<TIndex> cls_off_vec_;
+    std::vector<TIndex> lit_vec_;
+
+    // clauses containing the param in the CSR form
+    std::vector<TIndex> occ_off_vec_;
+    std::vector<TIndex> occ_vec_;
+
+    // 0 is FALSE, 1 is TRUE, 2 is free like in SMatch::EValue
+    std::vector<uint8_t> value_vec_;
+    std::vector<TIndex> trail_vec_;
+
+    // stamps of the decompose() traversal
+    uint64_t stamp_ = 0u;
+    std::vector<uint64_t> param_stamp_vec_;
+    std::vector<uint64_t> cls_stamp_vec_;
+
+    std::vector<TIndex> score_vec_; // scratch for the branching
+
+    std::unordered_map<std::vector<TIndex>, CBigUint, SKeyHash> cache_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CCOUNTSOLVER_HPP_
@@ -0,0 +1,174 @@
+#ifndef TINYSAT_CDISPATCHSOLVER_HPP_
+#define TINYSAT_CDISPATCHSOLVER_HPP_
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <memory>
+#include <optional>
+#include <variant>
+
+#include "CException.hpp"
+#include "CMatchIterator.hpp"
+#include "SFormula.hpp"
+#include "SMatch.hpp"
+
+#include "CBinarySolver.hpp"
+#include "CDpllSolver.hpp"
+#include "CGeneralSolver.hpp"
+#include "CHornSolver.hpp"
+
+#include "spdlog/spdlog.h"
+
+/// @brief
+namespace tinysat {
+
+/// Front-end solver choosing the engine by the formula class
+class CDispatchSolver;
+
+/**
+ * Analyses formula in a single linear pass and holds the chosen engine.
+ * Iteration goes over all the models whatever engine is chosen:
+ * Horn engine finds only the minimal model in linear time,
+ * so the rest ones are enumerated by DPLL skipping the minimal one.
+ * DPLL engine is built only if the iteration goes past the minimal model,
+ * so proceed() of the Horn formulas mustn't be called concurrently.
+ */
+class CDispatchSolver
+{
+public:
+    /// Context holding the chosen engine's context
+    class CContext;
+
+    using context_t = CContext; ///< Context alias
+    using CIterator = CMatchIterator<const CDispatchSolver>; ///< Iterator alias
+
+    /// Largest params' count solved by the brute force
+    static constexpr size_t TINY_PARAMS_CNT = 16u;
+
+    /// Engine chosen for the formula
+    enum class EEngine
+    {
+        UNSAT, ///< Formula has an empty clause
+        BINARY, ///< CBinarySolver, clauses have at most two literals
+        HORN, ///< CHornSolver, clauses have at most one positive literal
+        GENERAL, ///< CGeneralSolver, few params for the brute force
+        DPLL, ///< CDpllSolver, general case
+    };
+
+    /// Formula's class collected by the analysis pass
+    struct SStats
+    {
+        EEngine engine; ///< Dispatch decision
+        size_t params_cnt; ///< Count of the params
+        size_t clause_cnt; ///< Count of the clauses
+        size_t lit_cnt; ///< Total count of the literals
+        size_t max_clause_size; ///< Size of the widest clause
+        bool has_empty; ///< Formula has an empty clause
+        bool is_horn; ///< Every clause has at most one positive literal
+    };
+
+    /// Ctor from the general SAT formula and logger for DPLL
+    CDispatchSolver(const SFormula&, std::shared_ptr<spdlog::logger>);
+
+    /// Ctor from the rvalue SAT formula and logger for DPLL
+    CDispatchSolver(SFormula&&, std::shared_ptr<spdlog::logger>);
+
+    CDispatchSolver             (CDispatchSolver&&) = default; ///< Rule of 5
+    CDispatchSolver& operator = (CDispatchSolver&&) = default; ///< Rule of 5
+
+    /// Analyses formula in a single pass
+    [[nodiscard]] static SStats analyse(const SFormula&);
+
+    /// Chooses engine by the analysis results
+    [[nodiscard]] static EEngine choose(const SStats&) noexcept;
+
+    /// Returns engine's name for logs and reports
+    [[nodiscard]] static const char* engine_name(EEngine) noexcept;
+
+    /// Returns analysis results and dispatch decision
+    /**
+     * @return stats of the formula
+     */
+    [[nodiscard]] const SStats& stats() const noexcept
+    {
+        return stats_;
+    }
+
+    /// Get corresponding context
+    [[nodiscard]] std::unique_ptr<context_t> context() const;
+    /// Update context up to the next solution
+    void proceed(std::unique_ptr<context_t>&) const;
+
+    /// Get iterator pointing to the first solution
+    [[nodiscard]] CIterator begin() const;
+    /// Get iterator pointing past to the last solution
+    [[nodiscard]] CIterator end() const;
+
+protected:
+    /// Constructs the engine chosen for the formula
+    template<typename TFormula>
+    void init(TFormula&&);
+
+    /// Proceeds enumeration after the Horn engine's model
+    void proceed_rest(std::unique_ptr<context_t>&) const;
+
+private:
+    SStats stats_;
+    std::shared_ptr<spdlog::logger> logger_;
+
+    // DPLL enumerating the rest models of the Horn formula,
+    // built by the first proceed() past the Horn model
+    mutable std::optional<CDpllSolver> rest_solver_;
+    SMatch horn_match_;
+
+    std::variant<std::monostate,
+                 CBinarySolver,
+                 CHornSolver,
+                 CGeneralSolver,
+                 CDpllSolver> solver_;
+};
+
+/**
+ * Holds context of the engine
+ */
+class CDispatchSolver::CContext
+{
+public:
+    friend class CDispatchSolver;
+
+    /// Variant over the engines' contexts
+    using TContextVariant =
+        std::variant<std::unique_ptr<CBinarySolver::CContext>,
+                     std::unique_ptr<CHornSolver::CContext>,
+                     std::unique_ptr<CGeneralSolver::CContext>,
+                     std::unique_ptr<CDpllSolver::CContext>>;
+
+    /// Ctor from the engine's context
+    explicit CContext(TContextVariant&&);
+
+    CContext             (const CContext&); ///< Rule of 5
+    CContext& operator = (const CContext&); ///< Rule of 5
+    CContext             (CContext&&) = default; ///< Rule of 5
+    CContext& operator = (CContext&&) = default; ///< Rule of 5
+
+    /// Get corresponding match object
+    [[nodiscard]] SMatch match() const;
+
+    /// Comparison operator
+    friend
+    bool operator == (const CContext& lhs, const CContext& rhs);
+    /// Comparison operator
+    friend
+    bool operator != (const CContext& lhs, const CContext& rhs);
+
+private:
+    TContextVariant context_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CDISPATCHSOLVER_HPP_
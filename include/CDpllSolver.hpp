@@ -7,9 +7,17 @@
  * @date 2020
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 #include "CException.hpp"
+#include "CGenerator.hpp"
 #include "CMatchIterator.hpp"
 #include "SFormula.hpp"
 #include "SMatch.hpp"
@@ -33,9 +41,15 @@ public:
     /// Context incapsulating DPLL data
     class CContext;
 
+    /// Bounded channel of the solutions found ahead of the consumer
+    class CStream;
+
     using context_t = CContext; ///< Context alias
     using CIterator = CMatchIterator<const CDpllSolver>; ///< Iterator alias
 
+    /// Default count of the solutions buffered by the stream
+    static constexpr size_t DEFAULT_STREAM_CAPACITY = 16u;
+
     /// Ctor from the general SAT formula and logger
     CDpllSolver(const SFormula&, std::shared_ptr<spdlog::logger>);
 
@@ -47,19 +61,60 @@ public:
     CDpllSolver             (CDpllSolver&&) = default; ///< Rule of 5
     CDpllSolver& operator = (CDpllSolver&&) = default; ///< Rule of 5
 
+    /// Sets params to enumerate the distinct solutions over
+    /**
+     * @param [in] params projected params, all if empty
+     * @see CDpllContext::set_projection()
+     */
+    void set_projection(std::vector<int> params)
+    {
+        projection_vec_ = std::move(params);
+    }
+
+    /// Sets DRAT proof for the contexts to record their search to
+    /**
+     * @param [in] proof proof to write to or nullptr
+     * @see CDpllContext::set_proof()
+     */
+    void set_proof(std::shared_ptr<CDpllProof> proof)
+    {
+        proof_ = std::move(proof);
+    }
+
     /// Get corresponding context
     [[nodiscard]] std::unique_ptr<context_t> context() const;
     /// Update context up to the next solution
     void proceed(std::unique_ptr<context_t>&) const;
 
+    /// Finds the first solution in the background
+    [[nodiscard]] std::future<std::optional<SMatch>> 
+    solve_async(std::shared_ptr<std::atomic<bool>> stop_flag = nullptr) const;
+
+    /// Enumerates the solutions in the background
+    [[nodiscard]] std::unique_ptr<CStream> 
+    stream(size_t capacity = DEFAULT_STREAM_CAPACITY) const;
+
+    /// Lazily enumerates the solutions without copying the context
+    [[nodiscard]] CGenerator<const SMatch&> models() const;
+
     /// Get iterator pointing to the first solution
     [[nodiscard]] CIterator begin() const;
     /// Get iterator pointing past to the last solution
     [[nodiscard]] CIterator end() const;
 
+protected:
+    /// Get DPLL context with the solver's settings
+    [[nodiscard]] CDpllContext dpll_context() const;
+
+    /// Enumerates the solutions of the context owned by the coroutine
+    [[nodiscard]] static CGenerator<const SMatch&> generate(CDpllContext);
+
 private:
     SFormula formula_;
     std::shared_ptr<spdlog::logger> logger_;
+
+    std::vector<int> projection_vec_;
+    std::shared_ptr<CDpllProof> proof_;
 };
 
 /**
@@ -93,6 +148,62 @@ private:
     std::shared_ptr<spdlog::logger> logger_;
 };
 
+/**
+ * Owns the producer thread enumerating the solutions into the queue
+ * of at most capacity models, so the search runs ahead of the consumer
+ * and pauses when the queue is full.
+ * close() and dtor raise the stop flag of the search limits,
+ * so the producer is interrupted even in the middle of the search.
+ * @see CDpllContext::limits()
+ */
+class CDpllSolver::CStream
+{
+public:
+    /// Ctor from the DPLL context to search with
+    CStream(CDpllContext&&, size_t capacity, 
+            std::shared_ptr<spdlog::logger>);
+
+    CStream             (const CStream&) = delete; ///< Rule of 5
+    CStream& operator = (const CStream&) = delete; ///< Rule of 5
+    CStream             (CStream&&) = delete; ///< Rule of 5
+    CStream& operator = (CStream&&) = delete; ///< Rule of 5
+
+    /// Closes the stream and joins the producer
+    ~CStream();
+
+    /// Waits for the next solution
+    [[nodiscard]] std::optional<SMatch> pop();
+
+    /// Takes the next solution if it is ready
+    [[nodiscard]] std::optional<SMatch> try_pop();
+
+    /// Checks if all the solutions are taken
+    [[nodiscard]] bool done() const;
+
+    /// Stops the producer, buffered solutions stay available
+    void close();
+
+protected:
+    /// Producer's main loop
+    void work();
+
+private:
+    CDpllContext dpll_context_;
+    size_t capacity_;
+    std::shared_ptr<spdlog::logger> logger_;
+
+    std::shared_ptr<std::atomic<bool>> stop_flag_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable push_cv_;
+    std::condition_variable pop_cv_;
+
+    std::deque<SMatch> model_deq_;
+    bool finished_ = false;
+
+    std::thread producer_;
+};
+
 } // namespace tinysat
 
 #endif // TINYSAT_CDPLLSOLVER_HPP_
@@ -7,10 +7,15 @@
  * @date 2020
  */
 
+#include <cstdint>
+
 #include <memory>
+#include <vector>
 
 #include "CMatchIterator.hpp"
 #include "CException.hpp"
+#include "CLimits.hpp"
+#include "CThreadPool.hpp"
 #include "SFormula.hpp"
 
 /// @brief
@@ -37,19 +42,52 @@ public:
     using context_t = CContext; ///< context alias
     using CIterator = CMatchIterator<const CGeneralSolver>; ///< iterator alias
 
+    /// Bit mask over the candidate assignments evaluated at once
+    using TLaneMask = uint64_t;
+
+    /// Count of the lowest parameters enumerated inside of the lane mask
+    static constexpr size_t LANE_LOG = 6u;
+    /// Count of the candidate assignments evaluated at once
+    static constexpr size_t LANE_CNT = 1u << LANE_LOG;
+
+    /// Count of the blocks evaluated by a single parallel task
+    static constexpr size_t TASK_BLOCK_CNT = 1024u;
+    /// Count of the parallel tasks per worker in a single window
+    static constexpr size_t WORKER_TASK_CNT = 4u;
+
+    /// Null clause index representation
+    static constexpr size_t NULL_CLS = static_cast<size_t>(-1);
+
     explicit CGeneralSolver(const SFormula&); ///< Copy ctor from SAT formula
     explicit CGeneralSolver(SFormula&&); ///< Move ctor from SAT formula
 
+    /// Copy ctor from SAT formula enumerating on the thread pool
+    CGeneralSolver(const SFormula&, std::shared_ptr<CThreadPool>);
+    /// Move ctor from SAT formula enumerating on the thread pool
+    CGeneralSolver(SFormula&&, std::shared_ptr<CThreadPool>);
+
     CGeneralSolver             (CGeneralSolver&&) = default; ///< Move ctor
     CGeneralSolver& operator = (CGeneralSolver&&) = default; ///< Move operator
 
     void reset(const SFormula&); ///< Reset internal formula via copy
     void reset(SFormula&&); ///< Reset internal formula via move
 
-    /// Get context corresponding to the formula
+    /// Sets limits copied into the new contexts
+    /**
+     * @param [in] limits resource limits of the search
+     * @see CContext::limits()
+     */
+    void set_limits(const CLimits& limits)
+    {
+        limits_ = limits;
+    }
+
+    /// Get context corresponding to the formula, UNKNOWN if interrupted
     [[nodiscard]] std::unique_ptr<CContext> context() const;
-    /// Update context to find next solution
+    /// Update context to find next solution, resets it if interrupted
     void proceed(std::unique_ptr<CContext>&) const;
+    /// Find next solution or resume the interrupted search
+    EStatus resume(std::unique_ptr<CContext>&) const;
 
     /// Get iterator to the first solution
     [[nodiscard]] CIterator begin() const;
@@ -64,8 +102,45 @@ protected:
     /// Try to calculate next solution
     bool propagate(CContext&) const;
 
+    /// Try to calculate next solution in parallel mode
+    bool propagate_parallel(CContext&) const;
+
+    /// Switch to the next block of LANE_CNT candidates
+    bool next_block(CContext&) const;
+
+    /// Evaluate window of blocks starting from the given one in parallel
+    void fill_window(CContext&, uint64_t) const;
+
+    /// Evaluate formula over all candidates of the block
+    [[nodiscard]] TLaneMask evaluate(const TLaneMask* param_masks, 
+                                     size_t& watch_cls) const;
+
+    /// Evaluate single clause over all candidates of the block
+    [[nodiscard]] TLaneMask eval_clause(const TLaneMask* param_masks, 
+                                        size_t cls) const;
+
+    /// Assign the highest parameters corresponding to the given block
+    void set_block(CContext&, uint64_t block) const;
+
+    /// Assign the lowest parameters corresponding to the given lane
+    void set_lane(CContext&, size_t lane) const;
+
+    /// Represents literal as a parameter and a lane mask inversion
+    struct SBitLiteral
+    {
+        size_t param; ///< parameter's index
+        TLaneMask flip; ///< zero for positive, all ones for negative literal
+    };
+
 private:
     SFormula formula_;
+    std::shared_ptr<CThreadPool> thread_pool_;
+    CLimits limits_;
+
+    uint64_t block_cnt_ = 0u;
+    TLaneMask valid_mask_ = 0u;
+    std::vector<SBitLiteral> lit_vec_;
+    std::vector<size_t> cls_off_vec_;
 };
 
 // Context incapsulating data for the CGeneralSolver algorithm
@@ -93,6 +168,24 @@ public:
     /// Get corresponding match object
     [[nodiscard]] SMatch match() const;
 
+    /// Get resource limits checked by the search
+    /**
+     * @return limits to set up and counters
+     */
+    [[nodiscard]] CLimits& limits() noexcept
+    {
+        return limits_;
+    }
+
+    /// Get result of the last search
+    /**
+     * @return SAT, or UNKNOWN if interrupted by the limits
+     */
+    [[nodiscard]] EStatus status() const noexcept
+    {
+        return status_;
+    }
+
     /// Comparison operator
     friend bool operator == (const CContext& lhs, const CContext& rhs);
     /// Comparison operator
@@ -100,6 +193,17 @@ public:
 
 private:
     SMatch match_;
+
+    TLaneMask lane_mask_ = 0u;
+    std::vector<TLaneMask> param_mask_vec_;
+    size_t watch_cls_ = NULL_CLS;
+
+    uint64_t window_base_ = 0u;
+    size_t window_idx_ = 0u;
+    std::vector<TLaneMask> window_vec_;
+
+    CLimits limits_;
+    EStatus status_ = EStatus::SAT;
 };
 
 } // namespace tinysat
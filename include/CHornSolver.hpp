@@ -0,0 +1,122 @@
+#ifndef TINYSAT_CHORNSOLVER_HPP_
+#define TINYSAT_CHORNSOLVER_HPP_
+
+#include <cstdlib>
+
+#include <vector>
+#include <memory>
+#include <optional>
+
+#include "CMatchIterator.hpp"
+#include "CException.hpp"
+#include "SFormula.hpp"
+
+namespace tinysat {
+
+// SAT solver for the Horn and renamable Horn formulas
+//
+// Horn clause has at most one positive literal. Dowling-Gallier
+// propagation starts from all params FALSE and sets the head of a clause
+// once its body is fully TRUE, so the minimal model is found in linear
+// time. Renamable Horn formula becomes Horn after flipping some params,
+// the renaming is found via the 2-SAT encoding and undone in the model.
+// For the renamed formula the model is minimal over the renamed params.
+//
+// TODO:
+// - To search for multiple solutions
+// - To imlement LegasySolver concept
+//
+class CHornSolver
+{
+public:
+    class CContext;
+
+    using context_t = CContext;
+    using CIterator = CMatchIterator<const CHornSolver>;
+
+    enum class EHornKind
+    {
+        NONE,
+        HORN,
+        RENAMABLE
+    };
+
+    static constexpr size_t NULL_HEAD = static_cast<size_t>(-1);
+
+    explicit CHornSolver(const SFormula&);
+    explicit CHornSolver(SFormula&&);
+
+    // renaming found by find_renaming() is reused instead of the search
+    CHornSolver(const SFormula&, std::vector<bool> flip_vec);
+    CHornSolver(SFormula&&, std::vector<bool> flip_vec);
+
+    CHornSolver             (CHornSolver&&) = default;
+    CHornSolver& operator = (CHornSolver&&) = default;
+
+    void reset(const SFormula&);
+    void reset(SFormula&&);
+    void reset(const SFormula&, std::vector<bool> flip_vec);
+    void reset(SFormula&&, std::vector<bool> flip_vec);
+
+    [[nodiscard]] std::unique_ptr<CContext> context() const;
+    void proceed(std::unique_ptr<CContext>&) const;
+
+    [[nodiscard]] CIterator begin() const;
+    [[nodiscard]] CIterator end() const;
+
+    // formula as given, not renamed
+    [[nodiscard]] const SFormula& formula() const noexcept
+    {
+        return formula_;
+    }
+
+    // detectors allowing callers to route formulas to the solver
+    [[nodiscard]] static bool is_horn(const SFormula&);
+    [[nodiscard]] static EHornKind detect(const SFormula&);
+
+    // params to flip to get Horn formula or nullopt if impossible
+    [[nodiscard]] static std::optional<std::vector<bool>>
+    find_renaming(const SFormula&);
+
+protected:
+    void init();
+    void propagate();
+
+private:
+    SFormula formula_;
+    std::vector<bool> flip_vec_;
+
+    bool satisfiable_ = false;
+    SMatch match_;
+};
+
+// Context incapsulating data for the CHornSolver algorithm
+//
+// TODO:
+// - To imlement LegasyContext concept
+//
+class CHornSolver::CContext
+{
+public:
+    friend class CHornSolver;
+
+    explicit CContext(const SMatch& match);
+
+    CContext             (const CContext&) = default;
+    CContext& operator = (const CContext&) = default;
+
+    CContext             (CContext&&) = default;
+    CContext& operator = (CContext&&) = default;
+
+    [[nodiscard]] SMatch match() const;
+
+    friend bool operator == (const CContext& lhs, const CContext& rhs);
+    friend bool operator != (const CContext& lhs, const CContext& rhs);
+
+private:
+    SMatch match_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CHORNSOLVER_HPP_
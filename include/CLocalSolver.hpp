@@ -0,0 +1,175 @@
+#ifndef TINYSAT_CLOCALSOLVER_HPP_
+#define TINYSAT_CLOCALSOLVER_HPP_
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+#include "CMatchIterator.hpp"
+#include "CRandom.hpp"
+#include "CException.hpp"
+#include "SFormula.hpp"
+
+/// @brief
+namespace tinysat {
+
+/// Policy to pick the param to flip in an unsatisfied clause
+enum class ELocalPolicy
+{
+    PROBSAT, ///< Probability exponentially decreasing with the break count
+    WALKSAT, ///< Zero break, noisy random or the least break param
+};
+
+/// Parameters of the local search
+struct SLocalParams
+{
+    ELocalPolicy policy = ELocalPolicy::PROBSAT; ///< Pick policy
+    uint64_t max_flips = 1'000'000u; ///< Flips' budget per model
+    uint64_t seed = 2020u; ///< Seed of the random generator
+    double cb = 2.06; ///< probSAT base of the break exponent
+    double noise = 0.567; ///< WalkSAT random walk probability
+};
+
+/// Stochastic local search solver for the satisfiable formulas
+class CLocalSolver;
+
+/**
+ * Walks over the full assignments flipping params of unsatisfied clauses.
+ * Clause keeps the count of its TRUE literals and XOR of their params,
+ * so the only TRUE param of a critical clause is known at once and
+ * break counts are updated incrementally on every flip.
+ * Unsatisfied clauses are kept in a list with the O(1) removal.
+ *
+ * Search is incomplete: end of iteration means the flips' budget is
+ * exhausted, not that the formula is unsatisfiable.
+ * Next model is searched from the previous one, so models may repeat.
+ */
+class CLocalSolver
+{
+public:
+    /// Class representing the algorithm-specific data
+    class CContext;
+
+    using context_t = CContext; ///< context alias
+    using CIterator = CMatchIterator<const CLocalSolver>; ///< iterator alias
+
+    /// Index type of the hot arrays, halves their size compared to size_t
+    using TIndex = uint32_t;
+
+    /// Count of the precomputed probSAT probabilities
+    static constexpr size_t MAX_BREAK = 64u;
+
+    /// Ctor from SAT formula and search parameters
+    explicit CLocalSolver(const SFormula&, const SLocalParams& = {});
+
+    CLocalSolver             (CLocalSolver&&) = default; ///< Move ctor
+    CLocalSolver& operator = (CLocalSolver&&) = default; ///< Move operator
+
+    /// Get context with the first found model or nullptr
+    [[nodiscard]] std::unique_ptr<CContext> context() const;
+    /// Update context to the next found model
+    void proceed(std::unique_ptr<CContext>&) const;
+
+    /// Get iterator to the first solution
+    [[nodiscard]] CIterator begin() const;
+
+    /// Get iterator past to the last solution
+    [[nodiscard]] CIterator end() const;
+
+protected:
+    /// Build clause and occurrence lists
+    void init(const SFormula&);
+
+    /// Recompute the clause data for the current assignment
+    void restart(CContext&) const;
+
+    /// Walk until all the clauses are satisfied or budget is exhausted
+    bool walk(CContext&) const;
+
+    /// Pick param of the clause to flip
+    [[nodiscard]] TIndex pick(CContext&, TIndex cls) const;
+
+    /// Flip the param updating clause data and break counts
+    void flip(CContext&, TIndex param) const;
+
+private:
+    SLocalParams params_;
+
+    size_t params_cnt_ = 0u;
+    bool has_empty_ = false;
+
+    // literal is 2*param + 1 for negative
+    std::vector<TIndex> cls_off_vec_;
+    std::vector<TIndex> lit_vec_;
+
+    // clauses containing the literal in the CSR form
+    std::vector<TIndex> occ_off_vec_;
+    std::vector<TIndex> occ_vec_;
+
+    std::vector<double> prob_vec_;
+};
+
+/**
+ * Holds assignment, clause data and random generator
+ */
+class CLocalSolver::CContext
+{
+public:
+    friend class CLocalSolver;
+
+    CContext() = default; ///< Default ctor
+
+    CContext             (const CContext&) = default; ///< Copy ctor
+    CContext& operator = (const CContext&) = default; ///< Copy operator
+    CContext             (CContext&&) = default; ///< Move ctor
+    CContext& operator = (CContext&&) = default; ///< Move operator
+
+    /// Get current match
+    [[nodiscard]] SMatch match() const;
+
+    /// Get count of the flips made
+    /**
+     * @return flips' count
+     */
+    [[nodiscard]] uint64_t flips() const noexcept
+    {
+        return flips_;
+    }
+
+    /// Compare contexts
+    friend bool operator == (const CContext& lhs, const CContext& rhs);
+    /// Compare contexts
+    friend bool operator != (const CContext& lhs, const CContext& rhs);
+
+private:
+    CRandom gen_;
+    uint64_t flips_ = 0u;
+
+    std::vector<uint8_t> value_vec_;
+    std::vector<TIndex> break_vec_;
+
+    /// TRUE literals of the clause, kept together for a single cache miss
+    struct STrueData
+    {
+        TIndex cnt; ///< count of the TRUE literals
+        TIndex xor_param; ///< XOR of the params of the TRUE literals
+    };
+
+    std::vector<STrueData> true_vec_;
+
+    std::vector<TIndex> unsat_vec_;
+    std::vector<TIndex> unsat_pos_vec_;
+
+    std::vector<double> score_vec_; // scratch for the pick
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CLOCALSOLVER_HPP_
@@ -0,0 +1,130 @@
+#ifndef TINYSAT_CXORSOLVER_HPP_
+#define TINYSAT_CXORSOLVER_HPP_
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <vector>
+#include <memory>
+#include <optional>
+
+#include "CMatchIterator.hpp"
+#include "CException.hpp"
+#include "SFormula.hpp"
+#include "SXorFormula.hpp"
+
+namespace tinysat {
+
+// SAT solver for the systems of XOR clauses
+//
+// Gauss-Jordan elimination over GF(2) on the rows packed into 64-bit words
+// with the right-hand side stored as the last column. Pivots are taken
+// in blocks and other rows are reduced by the precomputed combination
+// of the block pivots, so each row gets one XOR per block.
+// Models are the particular solution plus the null space combinations,
+// they are enumerated in the Gray code order over the free params,
+// so the next model flips one free param and the pivots depending on it.
+//
+// Dense matrix takes clauses_cnt*params_cnt/8 bytes.
+//
+// TODO:
+// - To imlement LegasySolver concept
+//
+class CXorSolver
+{
+public:
+    class CContext;
+
+    using context_t = CContext;
+    using CIterator = CMatchIterator<const CXorSolver>;
+
+    using TWord = uint64_t;
+
+    static constexpr size_t WORD_LOG = 6u;
+    static constexpr size_t WORD_BITS = 1u << WORD_LOG;
+
+    // pivots eliminated at once via the table of their combinations
+    static constexpr size_t BLOCK_PIVOTS = 8u;
+
+    // widest CNF clause recognized as a part of XOR clause encoding
+    static constexpr size_t MAX_EXTRACT_SIZE = 16u;
+
+    explicit CXorSolver(const SXorFormula&);
+    explicit CXorSolver(SXorFormula&&);
+
+    // throws if the formula is not an encoding of XOR clauses
+    explicit CXorSolver(const SFormula&);
+
+    CXorSolver             (CXorSolver&&) = default;
+    CXorSolver& operator = (CXorSolver&&) = default;
+
+    void reset(const SXorFormula&);
+    void reset(SXorFormula&&);
+
+    [[nodiscard]] std::unique_ptr<CContext> context() const;
+    void proceed(std::unique_ptr<CContext>&) const;
+
+    [[nodiscard]] CIterator begin() const;
+    [[nodiscard]] CIterator end() const;
+
+    // recognizes XOR clauses encoded with the full sets of CNF clauses,
+    // returns nullopt if some clause is not a part of such encoding
+    [[nodiscard]] static std::optional<SXorFormula> extract(const SFormula&);
+
+    [[nodiscard]] size_t rank() const noexcept
+    {
+        return pivot_vec_.size();
+    }
+
+protected:
+    void init();
+    void eliminate();
+    void flip(CContext&, size_t free_idx) const;
+
+private:
+    SXorFormula formula_;
+    bool satisfiable_ = false;
+
+    // rows of the matrix, the rhs is the bit params_cnt
+    size_t row_words_ = 0u;
+    std::vector<TWord> row_vec_;
+
+    std::vector<size_t> pivot_vec_; // pivot param of the row
+    std::vector<size_t> free_vec_; // non-pivot params
+
+    // pivot params depending on the free param in the CSR form
+    std::vector<size_t> dep_off_vec_;
+    std::vector<size_t> dep_vec_;
+};
+
+// Context incapsulating data for the CXorSolver algorithm
+//
+// TODO:
+// - To imlement LegasyContext concept
+//
+class CXorSolver::CContext
+{
+public:
+    friend class CXorSolver;
+
+    explicit CContext(const SMatch& match);
+
+    CContext             (const CContext&) = default;
+    CContext& operator = (const CContext&) = default;
+
+    CContext             (CContext&&) = default;
+    CContext& operator = (CContext&&) = default;
+
+    [[nodiscard]] SMatch match() const;
+
+    friend bool operator == (const CContext& lhs, const CContext& rhs);
+    friend bool operator != (const CContext& lhs, const CContext& rhs);
+
+private:
+    SMatch match_;
+    uint64_t step_ = 0u; // index in the Gray code
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CXORSOLVER_HPP_
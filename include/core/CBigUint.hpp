@@ -0,0 +1,225 @@
+#ifndef TINYSAT_CBIGUINT_HPP_
+#define TINYSAT_CBIGUINT_HPP_
+
+#include <cstdint>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace tinysat {
+
+// Arbitrary-precision unsigned integer for the model counts
+//
+// Little-endian 32-bit limbs without leading zero limbs,
+// so zero is the empty vector and equal values have equal limbs.
+// Only the operations needed for counting are provided:
+// addition, multiplication, left shift and decimal output.
+//
+class CBigUint
+{
+public:
+    using TLimb = uint32_t;
+    using TWide = uint64_t;
+
+    static constexpr size_t LIMB_BITS = 32u;
+
+    CBigUint() = default;
+
+    CBigUint(uint64_t value)
+    {
+        for (; value != 0u; value >>= LIMB_BITS)
+            limb_vec_.push_back(static_cast<TLimb>(value));
+    }
+
+    CBigUint             (const CBigUint&) = default;
+    CBigUint& operator = (const CBigUint&) = default;
+    CBigUint             (CBigUint&&) = default;
+    CBigUint& operator = (CBigUint&&) = default;
+
+    [[nodiscard]] bool is_zero() const noexcept
+    {
+        return limb_vec_.empty();
+    }
+
+    // count of the significant bits
+    [[nodiscard]] size_t bit_width() const noexcept
+    {
+        if (limb_vec_.empty())
+            return 0u;
+
+        TLimb top = limb_vec_.back();
+        size_t width = 0u;
+        for (; top != 0u; top >>= 1u)
+            ++width;
+
+        return (limb_vec_.size() - 1u)*LIMB_BITS + width;
+    }
+
+    CBigUint& operator += (const CBigUint& other)
+    {
+        if (limb_vec_.size() < other.limb_vec_.size())
+            limb_vec_.resize(other.limb_vec_.size(), 0u);
+
+        TWide carry = 0u;
+        for (size_t idx = 0u; idx < limb_vec_.size(); ++idx)
+        {
+            carry += limb_vec_[idx];
+            if (idx < other.limb_vec_.size())
+                carry += other.limb_vec_[idx];
+
+            limb_vec_[idx] = static_cast<TLimb>(carry);
+            carry >>= LIMB_BITS;
+
+            if (carry == 0u && idx >= other.limb_vec_.size())
+                break;
+        }
+
+        if (carry != 0u)
+            limb_vec_.push_back(static_cast<TLimb>(carry));
+
+        return *this;
+    }
+
+    CBigUint& operator *= (const CBigUint& other)
+    {
+        if (is_zero() || other.is_zero())
+        {
+            limb_vec_.clear();
+            return *this;
+        }
+
+        std::vector<TLimb> result(limb_vec_.size() + other.limb_vec_.size(),
+                                  0u);
+
+        for (size_t lhs = 0u; lhs < limb_vec_.size(); ++lhs)
+        {
+            TWide carry = 0u;
+            for (size_t rhs = 0u; rhs < other.limb_vec_.size(); ++rhs)
+            {
+                carry += static_cast<TWide>(limb_vec_[lhs])*
+                         other.limb_vec_[rhs] + result[lhs + rhs];
+
+                result[lhs + rhs] = static_cast<TLimb>(carry);
+                carry >>= LIMB_BITS;
+            }
+
+            result[lhs + other.limb_vec_.size()] = static_cast<TLimb>(carry);
+        }
+
+        limb_vec_ = std::move(result);
+        trim();
+
+        return *this;
+    }
+
+    CBigUint& operator <<= (size_t shift)
+    {
+        if (is_zero())
+            return *this;
+
+        size_t limb_shift = shift / LIMB_BITS;
+        size_t bit_shift = shift % LIMB_BITS;
+
+        if (bit_shift != 0u)
+        {
+            TLimb carry = 0u;
+            for (auto& limb : limb_vec_)
+            {
+                TLimb next_carry = limb >> (LIMB_BITS - bit_shift);
+                limb = (limb << bit_shift) | carry;
+                carry = next_carry;
+            }
+
+            if (carry != 0u)
+                limb_vec_.push_back(carry);
+        }
+
+        limb_vec_.insert(std::begin(limb_vec_), limb_shift, 0u);
+
+        return *this;
+    }
+
+    [[nodiscard]] friend
+    CBigUint operator + (CBigUint lhs, const CBigUint& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    [[nodiscard]] friend
+    CBigUint operator * (CBigUint lhs, const CBigUint& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    [[nodiscard]] friend
+    CBigUint operator << (CBigUint lhs, size_t shift)
+    {
+        return lhs <<= shift;
+    }
+
+    [[nodiscard]] friend
+    bool operator == (const CBigUint& lhs, const CBigUint& rhs) noexcept
+    {
+        return lhs.limb_vec_ == rhs.limb_vec_;
+    }
+
+    [[nodiscard]] friend
+    bool operator != (const CBigUint& lhs, const CBigUint& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    // decimal digits via the repeated division by 10^9
+    [[nodiscard]] std::string to_string() const
+    {
+        if (is_zero())
+            return "0";
+
+        constexpr TWide CHUNK_BASE = 1'000'000'000u;
+        constexpr size_t CHUNK_DIGITS = 9u;
+
+        std::vector<TLimb> rest = limb_vec_;
+        std::string result;
+
+        while (!rest.empty())
+        {
+            TWide rem = 0u;
+            for (size_t idx = rest.size(); idx-- > 0u;)
+            {
+                TWide cur = (rem << LIMB_BITS) | rest[idx];
+                rest[idx] = static_cast<TLimb>(cur / CHUNK_BASE);
+                rem = cur % CHUNK_BASE;
+            }
+
+            while (!rest.empty() && rest.back() == 0u)
+                rest.pop_back();
+
+            for (size_t digit = 0u; digit < CHUNK_DIGITS; ++digit)
+            {
+                if (rest.empty() && rem == 0u)
+                    break;
+
+                result.push_back(static_cast<char>('0' + rem % 10u));
+                rem /= 10u;
+            }
+        }
+
+        std::reverse(std::begin(result), std::end(result));
+
+        return result;
+    }
+
+private:
+    void trim() noexcept
+    {
+        while (!limb_vec_.empty() && limb_vec_.back() == 0u)
+            limb_vec_.pop_back();
+    }
+
+    std::vector<TLimb> limb_vec_;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CBIGUINT_HPP_
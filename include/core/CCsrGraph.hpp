@@ -0,0 +1,186 @@
+#ifndef TINYSAT_CCSRGRAPH_HPP_
+#define TINYSAT_CCSRGRAPH_HPP_
+
+#include <span>
+#include <stack>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+namespace tinysat {
+
+// Immutable graph in the compressed sparse row form
+//
+// Interface:
+// - construction from the edge generator in two passes
+// - strongly connected components (iterative Tarjan)
+// - condensation
+//
+// Edge generator is called twice as gen(emit), where emit(beg, end)
+// inserts the edge, so no intermediate edge list is stored.
+//
+class CCsrGraph
+{
+public:
+    static constexpr size_t NULL_VERT = static_cast<size_t>(-1);
+
+    CCsrGraph() = default;
+
+    template<typename FEdgeGen>
+    CCsrGraph(size_t vert_cnt_set, FEdgeGen&& edge_gen);
+
+    CCsrGraph             (const CCsrGraph&) = default;
+    CCsrGraph& operator = (const CCsrGraph&) = default;
+    CCsrGraph             (CCsrGraph&&) = default;
+    CCsrGraph& operator = (CCsrGraph&&) = default;
+
+    [[nodiscard]] size_t vert_cnt() const noexcept
+    {
+        return off_vec_.empty() ? 0u : off_vec_.size() - 1u;
+    }
+
+    [[nodiscard]] size_t edge_cnt() const noexcept
+    {
+        return adj_vec_.size();
+    }
+
+    [[nodiscard]] std::span<const size_t> edges(size_t vert) const noexcept
+    {
+        return { adj_vec_.data() + off_vec_[vert],
+                 adj_vec_.data() + off_vec_[vert + 1u] };
+    }
+
+    // components are numbered in the topological order
+    // like in the CGraph::decompose()
+    std::vector<size_t> decompose() const;
+
+    // self-loops are dropped, parallel edges are kept
+    CCsrGraph compress(const std::vector<size_t>& comp_vec) const;
+
+private:
+    std::vector<size_t> off_vec_;
+    std::vector<size_t> adj_vec_;
+};
+
+template<typename FEdgeGen>
+CCsrGraph::CCsrGraph(size_t vert_cnt_set, FEdgeGen&& edge_gen):
+    off_vec_(vert_cnt_set + 1u, 0u),
+    adj_vec_()
+{
+    edge_gen([this] (size_t beg, size_t) { ++off_vec_[beg + 1u]; });
+
+    for (size_t vert = 0u; vert < vert_cnt_set; ++vert)
+        off_vec_[vert + 1u] += off_vec_[vert];
+
+    adj_vec_.resize(off_vec_.back());
+
+    std::vector<size_t> pos_vec(std::begin(off_vec_),
+                                std::prev(std::end(off_vec_)));
+
+    edge_gen([this, &pos_vec] (size_t beg, size_t end)
+             { adj_vec_[pos_vec[beg]++] = end; });
+}
+
+inline std::vector<size_t> CCsrGraph::decompose() const
+{
+    const size_t vert_cnt = this->vert_cnt();
+
+    std::vector<size_t> comp_vec(vert_cnt, NULL_VERT);
+    std::vector<size_t> index_vec(vert_cnt, NULL_VERT);
+    std::vector<size_t> low_vec(vert_cnt, NULL_VERT);
+
+    // (vertex, position of the next edge to visit)
+    std::stack<std::pair<size_t, size_t>,
+               std::vector<std::pair<size_t, size_t>>> call_stack;
+    std::stack<size_t, std::vector<size_t>> comp_stack;
+
+    size_t index_cnt = 0u;
+    size_t comp_cnt = 0u;
+
+    for (size_t start = 0u; start < vert_cnt; ++start)
+    {
+        if (index_vec[start] != NULL_VERT)
+            continue;
+
+        index_vec[start] = low_vec[start] = index_cnt++;
+        comp_stack.push(start);
+        call_stack.push({ start, off_vec_[start] });
+
+        while (!call_stack.empty())
+        {
+            auto& [vert, pos] = call_stack.top();
+
+            if (pos < off_vec_[vert + 1u])
+            {
+                size_t next = adj_vec_[pos++];
+
+                if (index_vec[next] == NULL_VERT)
+                {
+                    index_vec[next] = low_vec[next] = index_cnt++;
+                    comp_stack.push(next);
+                    call_stack.push({ next, off_vec_[next] });
+                }
+                else if (comp_vec[next] == NULL_VERT)
+                {
+                    // visited but not assigned means it is on the stack
+                    low_vec[vert] = std::min(low_vec[vert], index_vec[next]);
+                }
+
+                continue;
+            }
+
+            size_t root = vert;
+            call_stack.pop();
+
+            if (low_vec[root] == index_vec[root])
+            {
+                size_t top = NULL_VERT;
+                do
+                {
+                    top = comp_stack.top();
+                    comp_stack.pop();
+                    comp_vec[top] = comp_cnt;
+                }
+                while (top != root);
+
+                ++comp_cnt;
+            }
+
+            if (!call_stack.empty())
+            {
+                size_t parent = call_stack.top().first;
+                low_vec[parent] = std::min(low_vec[parent], low_vec[root]);
+            }
+        }
+    }
+
+    // Tarjan yields components in the reverse topological order
+    for (size_t& comp : comp_vec)
+        comp = comp_cnt - 1u - comp;
+
+    return comp_vec;
+}
+
+inline CCsrGraph CCsrGraph::compress(const std::vector<size_t>& comp_vec) const
+{
+    size_t comp_cnt = (comp_vec.empty() ? 0u :
+                       *std::max_element(std::begin(comp_vec),
+                                         std::end(comp_vec)) + 1u);
+
+    return CCsrGraph(comp_cnt,
+        [this, &comp_vec] (auto&& emit)
+        {
+            for (size_t vert = 0u; vert < vert_cnt(); ++vert)
+            {
+                for (size_t next : edges(vert))
+                {
+                    if (comp_vec[vert] != comp_vec[next])
+                        emit(comp_vec[vert], comp_vec[next]);
+                }
+            }
+        });
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CCSRGRAPH_HPP_
@@ -0,0 +1,172 @@
+#ifndef TINYSAT_CGENERATOR_HPP_
+#define TINYSAT_CGENERATOR_HPP_
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace tinysat {
+
+// Lazy range over the values yielded by the coroutine
+//
+// Minimal std::generator replacement: the coroutine is suspended
+// at each co_yield and the iterator refers to the yielded object
+// itself, so yielding a reference to the solver's state copies nothing.
+// Yielded reference is valid until the iterator is incremented.
+//
+// Requirements:
+// - TValue is a value or reference type
+//
+template<typename TValue>
+class CGenerator
+{
+public:
+    using value_type = std::remove_cvref_t<TValue>;
+    using reference = std::conditional_t<std::is_reference_v<TValue>,
+                                         TValue, const TValue&>;
+    using pointer = std::add_pointer_t<reference>;
+
+    struct promise_type
+    {
+        CGenerator get_return_object() noexcept
+        {
+            return CGenerator(THandle::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        // temporary lives until the end of co_yield's full-expression,
+        // which includes the suspension
+        std::suspend_always yield_value(reference value) noexcept
+        {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+
+        // only co_yield is allowed inside the generator
+        template<typename TAwaitable>
+        std::suspend_never await_transform(TAwaitable&&) = delete;
+
+        pointer value_ = nullptr;
+        std::exception_ptr exception_;
+    };
+
+    using THandle = std::coroutine_handle<promise_type>;
+
+    class CIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = CGenerator::value_type;
+        using reference = CGenerator::reference;
+        using pointer = CGenerator::pointer;
+
+        CIterator() = default;
+
+        explicit CIterator(THandle handle) noexcept:
+            handle_(handle)
+        {}
+
+        reference operator * () const noexcept
+        {
+            return static_cast<reference>(*handle_.promise().value_);
+        }
+
+        pointer operator -> () const noexcept
+        {
+            return handle_.promise().value_;
+        }
+
+        CIterator& operator ++ ()
+        {
+            resume(handle_);
+            return *this;
+        }
+
+        void operator ++ (int)
+        {
+            ++*this;
+        }
+
+        friend bool operator == (const CIterator& it, std::default_sentinel_t)
+        {
+            return it.handle_ == nullptr || it.handle_.done();
+        }
+
+    private:
+        THandle handle_ = nullptr;
+    };
+
+    CGenerator() = default;
+
+    CGenerator(const CGenerator&) = delete;
+    CGenerator& operator = (const CGenerator&) = delete;
+
+    CGenerator(CGenerator&& other) noexcept:
+        handle_(std::exchange(other.handle_, nullptr))
+    {}
+
+    CGenerator& operator = (CGenerator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+                handle_.destroy();
+
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~CGenerator()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    // starts the coroutine, so must be called once
+    CIterator begin()
+    {
+        if (handle_)
+            resume(handle_);
+
+        return CIterator(handle_);
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    explicit CGenerator(THandle handle) noexcept:
+        handle_(handle)
+    {}
+
+    static void resume(THandle handle)
+    {
+        handle.resume();
+        [[unlikely]]
+        if (handle.promise().exception_)
+            std::rethrow_exception(handle.promise().exception_);
+    }
+
+    THandle handle_ = nullptr;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CGENERATOR_HPP_
@@ -0,0 +1,168 @@
+#ifndef TINYSAT_CLIMITS_HPP_
+#define TINYSAT_CLIMITS_HPP_
+
+/**
+ * @file CLimits.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+
+/// @brief
+namespace tinysat {
+
+/// Result of the search with the resource limits
+enum class EStatus
+{
+    SAT, ///< Solution is found
+    UNSAT, ///< Search space is exhausted
+    UNKNOWN, ///< Search is interrupted by the limits and can be resumed
+};
+
+/// Resource limits of the search
+class CLimits;
+
+/**
+ * Holds deadline, decisions' and propagations' budgets and stop flag.
+ * Search reports its steps and polls exhausted() in the hot loop,
+ * the clock is read only once per CLOCK_PERIOD polls to keep it cheap.
+ * Budgets are relative to the counters at the moment they are set,
+ * so the interrupted search is resumed after a budget's increase.
+ */
+class CLimits
+{
+public:
+    using TClock = std::chrono::steady_clock; ///< Deadline's clock
+
+    /// Count of the polls per clock reading, power of 2
+    static constexpr uint64_t CLOCK_PERIOD = 256u;
+
+    /// Budget's value meaning no limit
+    static constexpr uint64_t UNLIMITED = std::numeric_limits<uint64_t>::max();
+
+    CLimits() = default; ///< Default ctor, no limits
+
+    CLimits             (const CLimits&) = default; ///< Rule of 5
+    CLimits& operator = (const CLimits&) = default; ///< Rule of 5
+    CLimits             (CLimits&&) = default; ///< Rule of 5
+    CLimits& operator = (CLimits&&) = default; ///< Rule of 5
+
+    /// Sets deadline as the time point
+    /**
+     * @param [in] deadline time point to interrupt the search after
+     */
+    void set_deadline(TClock::time_point deadline) noexcept
+    {
+        deadline_ = deadline;
+    }
+
+    /// Sets deadline relative to now
+    /**
+     * @param [in] timeout duration to interrupt the search after
+     */
+    void set_timeout(TClock::duration timeout) noexcept
+    {
+        deadline_ = TClock::now() + timeout;
+    }
+
+    /// Sets count of the decisions from now on
+    /**
+     * @param [in] budget count of the decisions or UNLIMITED
+     */
+    void set_decision_budget(uint64_t budget) noexcept
+    {
+        max_decisions_ = (budget == UNLIMITED ? UNLIMITED :
+                          decisions_ + budget);
+    }
+
+    /// Sets count of the propagations from now on
+    /**
+     * @param [in] budget count of the propagations or UNLIMITED
+     */
+    void set_propagation_budget(uint64_t budget) noexcept
+    {
+        max_propagations_ = (budget == UNLIMITED ? UNLIMITED :
+                             propagations_ + budget);
+    }
+
+    /// Sets flag to be raised from another thread to stop the search
+    /**
+     * @param [in] stop_flag shared flag or nullptr
+     */
+    void set_stop_flag(std::shared_ptr<std::atomic<bool>> stop_flag) noexcept
+    {
+        stop_flag_ = std::move(stop_flag);
+    }
+
+    /// Reports the decision
+    void on_decision() noexcept
+    {
+        ++decisions_;
+    }
+
+    /// Reports the propagations
+    /**
+     * @param [in] cnt count of the propagations
+     */
+    void on_propagation(uint64_t cnt = 1u) noexcept
+    {
+        propagations_ += cnt;
+    }
+
+    /// Checks if any limit is exhausted
+    /**
+     * @return true if search must be interrupted
+     */
+    [[nodiscard]] bool exhausted() noexcept
+    {
+        if (decisions_ >= max_decisions_ ||
+            propagations_ >= max_propagations_)
+            return true;
+
+        if (stop_flag_ != nullptr &&
+            stop_flag_->load(std::memory_order_relaxed))
+            return true;
+
+        return (deadline_ != TClock::time_point::max() &&
+                (ticks_++ & (CLOCK_PERIOD - 1u)) == 0u &&
+                TClock::now() >= deadline_);
+    }
+
+    /// Returns count of the reported decisions
+    /**
+     * @return decisions' count
+     */
+    [[nodiscard]] uint64_t decisions() const noexcept
+    {
+        return decisions_;
+    }
+
+    /// Returns count of the reported propagations
+    /**
+     * @return propagations' count
+     */
+    [[nodiscard]] uint64_t propagations() const noexcept
+    {
+        return propagations_;
+    }
+
+private:
+    TClock::time_point deadline_ = TClock::time_point::max();
+    uint64_t max_decisions_ = UNLIMITED;
+    uint64_t max_propagations_ = UNLIMITED;
+    std::shared_ptr<std::atomic<bool>> stop_flag_;
+
+    uint64_t decisions_ = 0u;
+    uint64_t propagations_ = 0u;
+    uint64_t ticks_ = 0u;
+};
+
+} // namespace tinysat
+
+#endif // TINYSAT_CLIMITS_HPP_
@@ -0,0 +1,218 @@
+#ifndef TINYSAT_CRANDOM_HPP_
+#define TINYSAT_CRANDOM_HPP_
+
+/**
+ * @file CRandom.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <atomic>
+#include <bit>
+#include <limits>
+
+/// @brief
+namespace tinysat {
+
+/// Seeded pseudo-random generator shared by the randomised components
+class CRandom;
+
+/**
+ * Implements xoshiro256** seeded via splitmix64,
+ * satisfies UniformRandomBitGenerator.
+ * Components without their own seed use the thread's stream local(),
+ * streams are derived from the solver-wide seed by jump() in the order
+ * of the threads' first use, so they never overlap and the single-thread
+ * runs are reproducible. set_seed() restarts all the streams.
+ */
+class CRandom
+{
+public:
+    using result_type = uint64_t; ///< Generated word's type
+
+    /// Seed used unless set_seed() is called
+    static constexpr uint64_t DEFAULT_SEED = 2020u;
+
+    /// Ctor from the seed and the stream's index
+    explicit CRandom(uint64_t seed = DEFAULT_SEED, uint64_t stream = 0u) noexcept
+    {
+        this->seed(seed, stream);
+    }
+
+    CRandom             (const CRandom&) = default; ///< Rule of 5
+    CRandom& operator = (const CRandom&) = default; ///< Rule of 5
+    CRandom             (CRandom&&) = default; ///< Rule of 5
+    CRandom& operator = (CRandom&&) = default; ///< Rule of 5
+
+    /// Reinitializes the state
+    /**
+     * @param [in] seed any 64-bit seed
+     * @param [in] stream index of the non-overlapping stream
+     */
+    void seed(uint64_t seed, uint64_t stream = 0u) noexcept
+    {
+        for (auto& word : state_arr_)
+            word = splitmix(seed);
+
+        for (; stream != 0u; --stream)
+            jump();
+    }
+
+    /// UniformRandomBitGenerator interface
+    [[nodiscard]] static constexpr result_type min() noexcept
+    {
+        return 0u;
+    }
+
+    /// UniformRandomBitGenerator interface
+    [[nodiscard]] static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// Generates next word
+    /**
+     * @return uniformly distributed 64-bit word
+     */
+    result_type operator () () noexcept
+    {
+        const uint64_t result = std::rotl(state_arr_[1u]*5u, 7)*9u;
+        const uint64_t shifted = state_arr_[1u] << 17u;
+
+        state_arr_[2u] ^= state_arr_[0u];
+        state_arr_[3u] ^= state_arr_[1u];
+        state_arr_[1u] ^= state_arr_[2u];
+        state_arr_[0u] ^= state_arr_[3u];
+
+        state_arr_[2u] ^= shifted;
+        state_arr_[3u] = std::rotl(state_arr_[3u], 45);
+
+        return result;
+    }
+
+    /// Generates index below the bound
+    /**
+     * @param [in] bound exclusive upper bound
+     * @return random index in [0, bound) via multiply-shift
+     */
+    [[nodiscard]] size_t below(size_t bound) noexcept
+    {
+        return static_cast<size_t>(
+            (static_cast<unsigned __int128>((*this)()) * bound) >> 64u);
+    }
+
+    /// Generates double in [0, 1)
+    /**
+     * @return random double from the highest 53 bits
+     */
+    [[nodiscard]] double unit() noexcept
+    {
+        return static_cast<double>((*this)() >> 11u) * 0x1.0p-53;
+    }
+
+    /// Generates geometrically distributed value
+    /**
+     * @param [in] max_value upper bound of the result, at most 65
+     * @return 1 + count of the successful coin flips, drawn from one word
+     */
+    [[nodiscard]] size_t geometric(size_t max_value) noexcept
+    {
+        const size_t value = 1u + static_cast<size_t>(std::countr_one((*this)()));
+        return (value < max_value ? value : max_value);
+    }
+
+    /// Advances the state by 2^128 steps
+    void jump() noexcept;
+
+    /// Sets solver-wide seed and restarts the threads' streams
+    static void set_seed(uint64_t seed) noexcept
+    {
+        global().seed.store(seed);
+        global().stream_cnt.store(0u);
+        global().epoch.fetch_add(1u);
+    }
+
+    /// Returns generator of the current thread
+    /**
+     * @return thread's stream of the solver-wide seed
+     */
+    [[nodiscard]] static CRandom& local() noexcept
+    {
+        static thread_local CRandom STATIC_random = CRandom();
+        static thread_local uint64_t STATIC_epoch = 0u;
+
+        // epoch 0 is never current, so the first use seeds the stream
+        const uint64_t epoch = global().epoch.load();
+        [[unlikely]]
+        if (STATIC_epoch != epoch)
+        {
+            STATIC_random.seed(global().seed.load(),
+                               global().stream_cnt.fetch_add(1u));
+            STATIC_epoch = epoch;
+        }
+
+        return STATIC_random;
+    }
+
+private:
+    /// Solver-wide seeding state
+    struct SGlobal
+    {
+        std::atomic<uint64_t> seed = DEFAULT_SEED;
+        std::atomic<uint64_t> stream_cnt = 0u;
+        std::atomic<uint64_t> epoch = 1u;
+    };
+
+    [[nodiscard]] static SGlobal& global() noexcept
+    {
+        static SGlobal STATIC_global = {};
+        return STATIC_global;
+    }
+
+    [[nodiscard]] static uint64_t splitmix(uint64_t& state) noexcept
+    {
+        uint64_t result = (state += 0x9e3779b97f4a7c15u);
+        result = (result ^ (result >> 30u))*0xbf58476d1ce4e5b9u;
+        result = (result ^ (result >> 27u))*0x94d049bb133111ebu;
+
+        return result ^ (result >> 31u);
+    }
+
+    uint64_t state_arr_[4u];
+};
+
+/**
+ * Equivalent to 2^128 calls of operator (),
+ * used to split the period into non-overlapping streams.
+ */
+inline void CRandom::jump() noexcept
+{
+    constexpr uint64_t JUMP_ARR[4u] = {
+        0x180ec6d33cfd0abau, 0xd5a61266f0c9392cu,
+        0xa9582618e03fc9aau, 0x39abdc4529b1661cu
+    };
+
+    uint64_t result_arr[4u] = {};
+    for (uint64_t jump_word : JUMP_ARR)
+    {
+        for (size_t bit = 0u; bit < 64u; ++bit)
+        {
+            if ((jump_word >> bit) & 1u)
+            {
+                for (size_t idx = 0u; idx < 4u; ++idx)
+                    result_arr[idx] ^= state_arr_[idx];
+            }
+
+            (*this)();
+        }
+    }
+
+    for (size_t idx = 0u; idx < 4u; ++idx)
+        state_arr_[idx] = result_arr[idx];
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CRANDOM_HPP_
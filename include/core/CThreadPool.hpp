@@ -0,0 +1,210 @@
+#ifndef TINYSAT_CTHREADPOOL_HPP_
+#define TINYSAT_CTHREADPOOL_HPP_
+
+/**
+ * @file CThreadPool.hpp
+ * @author geome_try
+ * @date 2020
+ */
+
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// @brief
+namespace tinysat {
+
+/// Persistent pool of worker threads
+class CThreadPool;
+
+/**
+ * Holds a fixed set of workers sleeping between jobs.
+ * Every job is a parallel loop over the task indices,
+ * tasks are grabbed by workers in chunks via the atomic counter.
+ */
+class CThreadPool
+{
+public:
+    /// Task functor: (task index, worker index)
+    using TTask = std::function<void(size_t, size_t)>;
+
+    /// Ctor from the workers' count
+    explicit CThreadPool(size_t workers_cnt =
+                         std::thread::hardware_concurrency());
+
+    CThreadPool             (const CThreadPool&) = delete; ///< Rule of 5
+    CThreadPool& operator = (const CThreadPool&) = delete; ///< Rule of 5
+    CThreadPool             (CThreadPool&&) = delete; ///< Rule of 5
+    CThreadPool& operator = (CThreadPool&&) = delete; ///< Rule of 5
+
+    /// Stops and joins all workers
+    ~CThreadPool();
+
+    /// Returns workers' count
+    /**
+     * @return workers' count
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return worker_vec_.size();
+    }
+
+    /// Runs task for every index in [0, task_cnt) and waits for completion
+    void run(size_t task_cnt, TTask task, size_t chunk_size = 1u);
+
+protected:
+    /// Worker's main loop
+    void work(size_t worker_idx);
+
+    /// Grabs and executes chunks of the current job
+    void execute(size_t worker_idx);
+
+private:
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+
+    bool stop_ = false;
+    uint64_t job_gen_ = 0u;
+    size_t busy_cnt_ = 0u;
+
+    TTask task_;
+    size_t task_cnt_ = 0u;
+    size_t chunk_size_ = 1u;
+    std::atomic<size_t> next_task_ = 0u;
+    std::exception_ptr error_;
+
+    std::vector<std::thread> worker_vec_;
+};
+
+/**
+ * @param [in] workers_cnt workers' count, at least one worker is created
+ */
+inline CThreadPool::CThreadPool(size_t workers_cnt)
+{
+    if (workers_cnt == 0u)
+        workers_cnt = 1u;
+
+    worker_vec_.reserve(workers_cnt);
+    for (size_t idx = 0u; idx < workers_cnt; ++idx)
+        worker_vec_.emplace_back(&CThreadPool::work, this, idx);
+}
+
+/**
+ * @see CThreadPool()
+ */
+inline CThreadPool::~CThreadPool()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+
+    job_cv_.notify_all();
+    for (auto& worker : worker_vec_)
+        worker.join();
+}
+
+/**
+ * @param [in] task_cnt tasks' count
+ * @param [in] task functor called as task(task_idx, worker_idx)
+ * @param [in] chunk_size count of the tasks grabbed by a worker at once
+ *
+ * Rethrows the first exception thrown by a task.
+ * Concurrent calls are serialized, each job owns the workers until done.
+ * Not reentrant: must not be called from the pool's own tasks.
+ */
+inline void CThreadPool::run(size_t task_cnt, TTask task, size_t chunk_size)
+{
+    if (task_cnt == 0u)
+        return;
+
+    // job's state is shared, so the next job waits for the current one
+    std::lock_guard run_lock(run_mutex_);
+    std::unique_lock lock(mutex_);
+
+    task_ = std::move(task);
+    task_cnt_ = task_cnt;
+    chunk_size_ = (chunk_size == 0u ? 1u : chunk_size);
+    next_task_.store(0u, std::memory_order_relaxed);
+    error_ = nullptr;
+    busy_cnt_ = worker_vec_.size();
+    ++job_gen_;
+
+    job_cv_.notify_all();
+    done_cv_.wait(lock, [this] { return busy_cnt_ == 0u; });
+
+    task_ = nullptr;
+    if (error_)
+        std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+/**
+ * @param [in] worker_idx index of the worker
+ */
+inline void CThreadPool::work(size_t worker_idx)
+{
+    uint64_t seen_gen = 0u;
+
+    std::unique_lock lock(mutex_);
+    while (true)
+    {
+        job_cv_.wait(lock, [this, seen_gen]
+                     { return stop_ || job_gen_ != seen_gen; });
+
+        if (stop_)
+            break;
+
+        seen_gen = job_gen_;
+
+        lock.unlock();
+        execute(worker_idx);
+        lock.lock();
+
+        if (--busy_cnt_ == 0u)
+            done_cv_.notify_one();
+    }
+}
+
+/**
+ * @param [in] worker_idx index of the worker
+ */
+inline void CThreadPool::execute(size_t worker_idx)
+{
+    while (true)
+    {
+        size_t beg = next_task_.fetch_add(chunk_size_,
+                                          std::memory_order_relaxed);
+        if (beg >= task_cnt_)
+            break;
+
+        size_t end = std::min(beg + chunk_size_, task_cnt_);
+        try
+        {
+            for (size_t idx = beg; idx < end; ++idx)
+                task_(idx, worker_idx);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(mutex_);
+            if (!error_)
+                error_ = std::current_exception();
+
+            // drain the remaining tasks
+            next_task_.store(task_cnt_, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_CTHREADPOOL_HPP_
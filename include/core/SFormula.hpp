@@ -7,6 +7,7 @@
 #include <iostream>
 
 #include "SMatch.hpp"
+#include "SPackedMatch.hpp"
 
 namespace tinysat {
 
@@ -18,6 +19,7 @@ TStream& operator << (TStream&, const SFormula&);
 struct SFormula
 {
     [[nodiscard]] inline bool is_match(const SMatch&) const;
+    [[nodiscard]] inline bool is_match(const SPackedMatch&) const;
 
     size_t params_cnt;
     std::vector<std::vector<int32_t>> clause_vec;
@@ -52,6 +54,43 @@ inline bool SFormula::is_match(const SMatch& match) const
     return result;
 }
 
+// Literal is satisfied if its param is assigned and its value bit
+// equals the literal's sign, so each literal is a couple of bit tests.
+inline bool SFormula::is_match(const SPackedMatch& match) const
+{
+    if (this->params_cnt != match.params_cnt)
+        return false;
+
+    const auto* value_data = match.value_vec.data();
+    const auto* assigned_data = match.assigned_vec.data();
+
+    for (const auto& clause : this->clause_vec)
+    {
+        bool clause_result = false;
+        for (const auto& literal : clause)
+        {
+            const size_t param = (literal < 0 ? -literal : literal) - 1u;
+            const size_t word = param >> SPackedMatch::WORD_LOG;
+            const size_t bit = param & (SPackedMatch::WORD_BITS - 1u);
+
+            const SPackedMatch::TWord value = 
+                value_data[word] ^ (literal < 0 ? ~SPackedMatch::TWord(0u) : 
+                                                  SPackedMatch::TWord(0u));
+
+            if (((value & assigned_data[word]) >> bit) & 1u)
+            {
+                clause_result = true;
+                break;
+            }
+        }
+
+        if (!clause_result)
+            return false;
+    }
+
+    return true;
+}
+
 template<typename TStream>
 TStream& operator << (TStream& stream, const SFormula& formula)
 {
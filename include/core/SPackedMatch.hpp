@@ -0,0 +1,173 @@
+#ifndef TINYSAT_SPACKEDMATCH_HPP_
+#define TINYSAT_SPACKEDMATCH_HPP_
+
+#include <cstdint>
+
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+#include "SMatch.hpp"
+
+namespace tinysat {
+
+struct SPackedMatch;
+
+inline bool operator == (const SPackedMatch& lhs, const SPackedMatch& rhs);
+inline bool operator != (const SPackedMatch& lhs, const SPackedMatch& rhs);
+
+[[nodiscard]] inline SPackedMatch pack(const SMatch&);
+[[nodiscard]] inline SMatch unpack(const SPackedMatch&);
+
+template<typename TStream>
+TStream& operator << (TStream&, const SPackedMatch&);
+
+// Match with 2 bits per param stored in two bitsets
+//
+// Param's bit in assigned_vec is set if it isn't NONE,
+// bit in value_vec is set if it is TRUE.
+// Bits past params_cnt are always zero, so the words are compared as is.
+struct SPackedMatch
+{
+    using TWord = uint64_t;
+
+    static constexpr size_t WORD_LOG = 6u;
+    static constexpr size_t WORD_BITS = 1u << WORD_LOG;
+
+    [[nodiscard]] static constexpr size_t words_cnt(size_t params_cnt)
+    {
+        return (params_cnt + WORD_BITS - 1u) >> WORD_LOG;
+    }
+
+    [[nodiscard]] inline SMatch::EValue get(size_t param) const;
+    inline void set(size_t param, SMatch::EValue value);
+
+    size_t params_cnt;
+    std::vector<TWord> value_vec;
+    std::vector<TWord> assigned_vec;
+};
+
+inline SMatch::EValue SPackedMatch::get(size_t param) const
+{
+    const size_t word = param >> WORD_LOG;
+    const size_t bit = param & (WORD_BITS - 1u);
+
+    if (((assigned_vec[word] >> bit) & 1u) == 0u)
+        return SMatch::EValue::NONE;
+
+    return ((value_vec[word] >> bit) & 1u ? SMatch::EValue::TRUE :
+                                            SMatch::EValue::FALSE);
+}
+
+inline void SPackedMatch::set(size_t param, SMatch::EValue value)
+{
+    const size_t word = param >> WORD_LOG;
+    const TWord mask = TWord(1u) << (param & (WORD_BITS - 1u));
+
+    value_vec[word] &= ~mask;
+    assigned_vec[word] &= ~mask;
+
+    if (value != SMatch::EValue::NONE)
+        assigned_vec[word] |= mask;
+
+    if (value == SMatch::EValue::TRUE)
+        value_vec[word] |= mask;
+}
+
+inline bool operator == (const SPackedMatch& lhs, const SPackedMatch& rhs)
+{
+    return lhs.params_cnt == rhs.params_cnt &&
+           lhs.value_vec == rhs.value_vec &&
+           lhs.assigned_vec == rhs.assigned_vec;
+}
+
+inline bool operator != (const SPackedMatch& lhs, const SPackedMatch& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// Builds whole words at once, as EValue's low bit is the value
+// and its high bit marks NONE.
+inline SPackedMatch pack(const SMatch& match)
+{
+    using TWord = SPackedMatch::TWord;
+
+    const size_t params_cnt = match.value_vec.size();
+    const size_t words_cnt = SPackedMatch::words_cnt(params_cnt);
+
+    SPackedMatch result = {
+        .params_cnt = params_cnt,
+        .value_vec = std::vector<TWord>(words_cnt, 0u),
+        .assigned_vec = std::vector<TWord>(words_cnt, 0u)
+    };
+
+    const auto* data = match.value_vec.data();
+    for (size_t word = 0u; word < words_cnt; ++word)
+    {
+        const size_t base = word << SPackedMatch::WORD_LOG;
+        const size_t cnt = std::min(SPackedMatch::WORD_BITS,
+                                    params_cnt - base);
+
+        TWord value = 0u, none = 0u;
+        for (size_t bit = 0u; bit < cnt; ++bit)
+        {
+            const auto code = static_cast<TWord>(data[base + bit]);
+            value |= (code & 1u) << bit;
+            none |= (code >> 1u) << bit;
+        }
+
+        const TWord mask = (cnt == SPackedMatch::WORD_BITS ? ~TWord(0u) :
+                            (TWord(1u) << cnt) - 1u);
+
+        result.value_vec[word] = value;
+        result.assigned_vec[word] = ~none & mask;
+    }
+
+    return result;
+}
+
+inline SMatch unpack(const SPackedMatch& match)
+{
+    SMatch result = {
+        .value_vec = std::vector<SMatch::EValue>(match.params_cnt)
+    };
+
+    auto* data = result.value_vec.data();
+    for (size_t param = 0u; param < match.params_cnt; ++param)
+    {
+        const size_t word = param >> SPackedMatch::WORD_LOG;
+        const size_t bit = param & (SPackedMatch::WORD_BITS - 1u);
+
+        const auto value = (match.value_vec[word] >> bit) & 1u;
+        const auto none = ((match.assigned_vec[word] >> bit) & 1u) ^ 1u;
+
+        data[param] = static_cast<SMatch::EValue>(value | (none << 1u));
+    }
+
+    return result;
+}
+
+template<typename TStream>
+TStream& operator << (TStream& stream, const SPackedMatch& match)
+{
+    stream << "[ ";
+    for (size_t param = 0u; param < match.params_cnt; ++param)
+    {
+        switch (match.get(param))
+        {
+            case SMatch::EValue::TRUE: stream << "T "; break;
+            case SMatch::EValue::FALSE: stream << "F "; break;
+
+            case SMatch::EValue::NONE: [[fallthrough]];
+            default: stream << "X "; break;
+        }
+    }
+
+    stream << "]";
+
+    return stream;
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_SPACKEDMATCH_HPP_
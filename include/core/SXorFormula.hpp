@@ -0,0 +1,77 @@
+#ifndef TINYSAT_SXORFORMULA_HPP_
+#define TINYSAT_SXORFORMULA_HPP_
+
+#include <cstdint>
+
+#include <vector>
+#include <iostream>
+
+#include "SMatch.hpp"
+
+namespace tinysat {
+
+struct SXorFormula;
+
+template<typename TStream>
+TStream& operator << (TStream&, const SXorFormula&);
+
+// Conjunction of XOR clauses
+//
+// Clause is satisfied if XOR of its literals is TRUE,
+// so the empty clause is unsatisfiable like in SFormula
+//
+struct SXorFormula
+{
+    [[nodiscard]] inline bool is_match(const SMatch&) const;
+
+    size_t params_cnt;
+    std::vector<std::vector<int32_t>> clause_vec;
+};
+
+inline bool SXorFormula::is_match(const SMatch& match) const
+{
+    if (this->params_cnt != match.value_vec.size())
+        return false;
+
+    for (const auto& clause : this->clause_vec)
+    {
+        bool clause_result = false;
+        for (const auto& literal : clause)
+        {
+            clause_result = clause_result !=
+                (literal < 0 ?
+                 match.value_vec[-literal - 1u] == SMatch::EValue::FALSE :
+                 match.value_vec[literal - 1u] == SMatch::EValue::TRUE);
+        }
+
+        if (!clause_result)
+            return false;
+    }
+
+    return true;
+}
+
+template<typename TStream>
+TStream& operator << (TStream& stream, const SXorFormula& formula)
+{
+    stream << "[ ";
+    stream << "p " << formula.params_cnt << " ";
+    stream << "x " << formula.clause_vec.size() << " ";
+
+    for (const auto& clause : formula.clause_vec)
+    {
+        stream << "[ ";
+        for (const auto& val : clause)
+            stream << val << " ";
+
+        stream << "] ";
+    }
+
+    stream << "]";
+
+    return stream;
+}
+
+} // namespace tinysat
+
+#endif // TINYSAT_SXORFORMULA_HPP_
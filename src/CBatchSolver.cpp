@@ -0,0 +1,60 @@
+#include "CBatchSolver.hpp"
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+/// @brief
+namespace tinysat {
+
+/**
+ * @param [in] workers_cnt count of the pool's workers
+ */
+CBatchSolver::CBatchSolver(size_t workers_cnt):
+    thread_pool_(std::make_unique<CThreadPool>(workers_cnt)),
+    context_vec_(thread_pool_->size())
+{}
+
+/**
+ * @param [in] formula_span formulas to solve
+ * @return first model of each formula or nullopt if it is unsatisfiable
+ */
+std::vector<CBatchSolver::result_t>
+CBatchSolver::solve(std::span<const SFormula> formula_span)
+{
+    std::vector<result_t> result_vec(formula_span.size());
+    solve(formula_span, result_vec);
+
+    return result_vec;
+}
+
+/**
+ * @param [in] formula_span formulas to solve
+ * @param [out] result_span first model of each formula or nullopt
+ */
+void CBatchSolver::solve(std::span<const SFormula> formula_span,
+                         std::span<result_t> result_span)
+{
+    if (formula_span.size() != result_span.size())
+        throw CException("batch and result sizes mismatch");
+
+    // small chunks for balance, but not too small to contend on the counter
+    size_t chunk_size = formula_span.size()/(8u*thread_pool_->size()) + 1u;
+
+    thread_pool_->run(formula_span.size(),
+        [this, formula_span, result_span] (size_t idx, size_t worker_idx)
+        {
+            auto& context = context_vec_[worker_idx];
+            context.reset(formula_span[idx]);
+
+            if (context.init())
+                result_span[idx] = context.match();
+            else
+                result_span[idx].reset();
+        },
+        chunk_size);
+}
+
+} // namespace tinysat
@@ -5,7 +5,15 @@ namespace tinysat {
 CBinarySolver::CBinarySolver(const SFormula& formula):
     formula_{},
     comp_vec_{},
-    comp_graph_(2u*formula.params_cnt)
+    comp_graph_{},
+    neg_comp_vec_{},
+    memb_off_vec_{},
+    memb_vec_{},
+    delta_adj_vec_{},
+    comp_model_vec_{},
+    flip_vec_{},
+    stack_vec_{},
+    stamp_vec_{}
 {
     reset(formula);
 }
@@ -13,7 +21,15 @@ CBinarySolver::CBinarySolver(const SFormula& formula):
 CBinarySolver::CBinarySolver(SFormula&& formula):
     formula_{},
     comp_vec_{},
-    comp_graph_(2u*formula.params_cnt)
+    comp_graph_{},
+    neg_comp_vec_{},
+    memb_off_vec_{},
+    memb_vec_{},
+    delta_adj_vec_{},
+    comp_model_vec_{},
+    flip_vec_{},
+    stack_vec_{},
+    stamp_vec_{}
 {
     reset(std::move(formula));
 }
@@ -30,23 +46,64 @@ void CBinarySolver::reset(SFormula&& formula)
     init();
 }
 
-std::unique_ptr<CBinarySolver::CContext>
-CBinarySolver::context() const
+bool CBinarySolver::add_clause(const std::vector<int32_t>& clause)
 {
-    for (size_t param = 0u; param < formula_.params_cnt; ++param)
+    [[unlikely]]
+    if (clause.size() > 2u)
+        throw CException("2-SAT solver got non-2-SAT clause");
+
+    for (int32_t literal : clause)
     {
-        if (comp_vec_[param] == comp_vec_[param + formula_.params_cnt])
-            return nullptr;
+        [[unlikely]]
+        if (literal == 0 || static_cast<size_t>(std::abs(literal)) > 
+                            formula_.params_cnt)
+            throw CException("literal is out of range");
     }
 
-    size_t comp_cnt = comp_graph_.edge_vec().size();
+    formula_.clause_vec.push_back(clause);
 
-    std::vector<size_t> order_vec(comp_cnt);
-    for (size_t comp = 0u; comp < comp_cnt; ++comp)
-        order_vec[comp] = comp;
+    if (!satisfiable_)
+        return false;
+
+    if (clause.empty())
+        return (satisfiable_ = false);
 
-    auto result = std::make_unique<CContext>(std::move(order_vec));
-    set_match(*result);
+    size_t lhs_comp = lit_comp(clause[0u]);
+    size_t rhs_comp = lit_comp(clause.back());
+
+    // rebuild amortized over the delta edges
+    if (delta_cnt_ + 2u > comp_graph_.edge_cnt() + comp_graph_.vert_cnt())
+    {
+        init();
+        return satisfiable_;
+    }
+
+    if (delta_adj_vec_.empty())
+        delta_adj_vec_.resize(comp_graph_.vert_cnt());
+
+    if (neg_comp_vec_[lhs_comp] != rhs_comp)
+    {
+        delta_adj_vec_[neg_comp_vec_[lhs_comp]].push_back(rhs_comp);
+        delta_adj_vec_[neg_comp_vec_[rhs_comp]].push_back(lhs_comp);
+        delta_cnt_ += 2u;
+    }
+
+    if (comp_model_vec_[lhs_comp] || comp_model_vec_[rhs_comp])
+        return true;
+
+    satisfiable_ = repair(lhs_comp) || repair(rhs_comp);
+    return satisfiable_;
+}
+
+std::unique_ptr<CBinarySolver::CContext>
+CBinarySolver::context() const
+{
+    if (!satisfiable_)
+        return nullptr;
+
+    auto result = std::make_unique<CContext>(formula_.params_cnt,
+                                             comp_graph_.vert_cnt());
+    descend(*result, 0u);
 
     return std::move(result);
 }
@@ -57,7 +114,8 @@ void CBinarySolver::proceed(std::unique_ptr<CContext>& context) const
     if (context == nullptr)
         throw CException("trying to proceed over the end");
 
-    context = nullptr;
+    if (!backtrack(*context))
+        context = nullptr;
 }
 
 CBinarySolver::CIterator CBinarySolver::begin() const
@@ -80,52 +138,264 @@ void CBinarySolver::init()
     }
 
     size_t half_cnt = formula_.params_cnt;
-    CGraph<std::set> impl_graph(2u*half_cnt);
 
+    // implication graph is generated twice by the CSR builder
+    CCsrGraph impl_graph(2u*half_cnt,
+        [this, half_cnt] (auto&& emit)
+        {
+            for (const auto& clause : formula_.clause_vec)
+            {
+                [[unlikely]]
+                if (clause.empty())
+                    continue;
+
+                int lhs_v = clause[0u];
+                int rhs_v = (clause.size() == 2u ? clause[1u] : lhs_v);
+
+                lhs_v = (lhs_v > 0 ? (lhs_v - 1) : half_cnt + (-lhs_v - 1));
+                rhs_v = (rhs_v > 0 ? (rhs_v - 1) : half_cnt + (-rhs_v - 1));
+
+                emit((lhs_v + half_cnt)%(2u*half_cnt), rhs_v);
+                emit((rhs_v + half_cnt)%(2u*half_cnt), lhs_v);
+            }
+        });
+
+    comp_vec_ = impl_graph.decompose();
+    comp_graph_ = impl_graph.compress(comp_vec_);
+
+    size_t comp_cnt = comp_graph_.vert_cnt();
+
+    satisfiable_ = true;
     for (const auto& clause : formula_.clause_vec)
+        satisfiable_ = satisfiable_ && !clause.empty();
+
+    neg_comp_vec_.assign(comp_cnt, CCsrGraph::NULL_VERT);
+    for (size_t param = 0u; param < half_cnt; ++param)
     {
-        [[unlikely]]
-        if (clause.empty())
+        size_t pos_comp = comp_vec_[param];
+        size_t neg_comp = comp_vec_[param + half_cnt];
+
+        satisfiable_ = satisfiable_ && (pos_comp != neg_comp);
+
+        neg_comp_vec_[pos_comp] = neg_comp;
+        neg_comp_vec_[neg_comp] = pos_comp;
+    }
+
+    memb_off_vec_.assign(comp_cnt + 1u, 0u);
+    for (size_t comp : comp_vec_)
+        ++memb_off_vec_[comp + 1u];
+
+    for (size_t comp = 0u; comp < comp_cnt; ++comp)
+        memb_off_vec_[comp + 1u] += memb_off_vec_[comp];
+
+    memb_vec_.resize(comp_vec_.size());
+
+    std::vector<size_t> pos_vec(std::begin(memb_off_vec_),
+                                std::prev(std::end(memb_off_vec_)));
+    for (size_t vert = 0u; vert < comp_vec_.size(); ++vert)
+        memb_vec_[pos_vec[comp_vec_[vert]]++] = vert;
+
+    // topological model: the later component of the pair is TRUE
+    comp_model_vec_.assign(comp_cnt, false);
+    for (size_t comp = 0u; comp < comp_cnt; ++comp)
+        comp_model_vec_[comp] = (neg_comp_vec_[comp] < comp);
+
+    delta_adj_vec_.clear();
+    delta_cnt_ = 0u;
+
+    stamp_vec_.assign(comp_cnt, 0u);
+    stamp_ = 0u;
+}
+
+// makes the component TRUE flipping the FALSE part of its closure,
+// returns false and keeps the model if the closure is contradictory
+bool CBinarySolver::repair(size_t comp)
+{
+    // stamp marks the components required to be TRUE
+    ++stamp_;
+    flip_vec_.clear();
+    stack_vec_.clear();
+
+    bool result = true;
+
+    stamp_vec_[comp] = stamp_;
+    stack_vec_.push_back(comp);
+
+    while (result && !stack_vec_.empty())
+    {
+        size_t cur = stack_vec_.back();
+        stack_vec_.pop_back();
+
+        if (comp_model_vec_[cur])
             continue;
 
-        int lhs_v = clause[0u];
-        int rhs_v = (clause.size() == 2u ? clause[1u] : lhs_v);
+        comp_model_vec_[cur] = true;
+        comp_model_vec_[neg_comp_vec_[cur]] = false;
+        flip_vec_.push_back(cur);
 
-        lhs_v = (lhs_v > 0 ? (lhs_v - 1) : half_cnt + (-lhs_v - 1));
-        rhs_v = (rhs_v > 0 ? (rhs_v - 1) : half_cnt + (-rhs_v - 1));
+        visit_edges(cur, [this, &result] (size_t next)
+        {
+            if (stamp_vec_[next] == stamp_)
+                return;
 
-        impl_graph.insert_or_edge((lhs_v + half_cnt)%(2u*half_cnt), rhs_v);
-        impl_graph.insert_or_edge((rhs_v + half_cnt)%(2u*half_cnt), lhs_v);
+            if (stamp_vec_[neg_comp_vec_[next]] == stamp_)
+                result = false;
+
+            stamp_vec_[next] = stamp_;
+            stack_vec_.push_back(next);
+        });
     }
 
-    comp_vec_ = impl_graph.decompose();
-    comp_graph_ = impl_graph.compress(comp_vec_);
+    if (!result)
+    {
+        for (size_t flip : flip_vec_)
+        {
+            comp_model_vec_[flip] = false;
+            comp_model_vec_[neg_comp_vec_[flip]] = true;
+        }
+    }
+
+    return result;
 }
 
-void CBinarySolver::set_match(CContext& context) const
+// sets the component TRUE with all its consequences,
+// returns false on conflict leaving the partial trail to rewind
+bool CBinarySolver::assign(CContext& context, size_t comp) const
 {
-    context.match_.value_vec.resize(formula_.params_cnt);
+    auto& value_vec = context.comp_value_vec_;
+    auto& queue_vec = context.queue_vec_;
 
-    for (size_t param = 0u; param < formula_.params_cnt; ++param)
+    auto set_true = [this, &context, &value_vec, &queue_vec] (size_t comp)
     {
-        context.match_.value_vec[param] =
-            (context.order_vec_[comp_vec_[param]] < 
-             context.order_vec_[comp_vec_[param + formula_.params_cnt]] ?
-             SMatch::EValue::FALSE : SMatch::EValue::TRUE);
+        value_vec[comp] = SMatch::EValue::TRUE;
+        value_vec[neg_comp_vec_[comp]] = SMatch::EValue::FALSE;
+
+        for (size_t idx = memb_off_vec_[comp]; 
+             idx < memb_off_vec_[comp + 1u]; ++idx)
+        {
+            size_t vert = memb_vec_[idx];
+            context.match_.value_vec[vert % formula_.params_cnt] =
+                (vert < formula_.params_cnt ?
+                 SMatch::EValue::TRUE : SMatch::EValue::FALSE);
+        }
+
+        context.trail_vec_.push_back(comp);
+        queue_vec.push_back(comp);
+    };
+
+    if (value_vec[comp] != SMatch::EValue::NONE)
+        return value_vec[comp] == SMatch::EValue::TRUE;
+
+    queue_vec.clear();
+    set_true(comp);
+
+    while (!queue_vec.empty())
+    {
+        size_t cur = queue_vec.back();
+        queue_vec.pop_back();
+
+        bool result = true;
+        visit_edges(cur, [&value_vec, &set_true, &result] (size_t next)
+        {
+            if (value_vec[next] == SMatch::EValue::FALSE)
+                result = false;
+            else if (value_vec[next] == SMatch::EValue::NONE)
+                set_true(next);
+        });
+
+        if (!result)
+            return false;
     }
+
+    return true;
 }
 
-CBinarySolver::CContext::
-CContext(const std::vector<size_t>& order_vec):
-    match_{},
-    order_vec_(order_vec)
-{}
+void CBinarySolver::rewind(CContext& context, size_t trail_size) const
+{
+    while (context.trail_vec_.size() > trail_size)
+    {
+        size_t comp = context.trail_vec_.back();
+        context.trail_vec_.pop_back();
+
+        context.comp_value_vec_[comp] = SMatch::EValue::NONE;
+        context.comp_value_vec_[neg_comp_vec_[comp]] = SMatch::EValue::NONE;
+
+        for (size_t idx = memb_off_vec_[comp]; 
+             idx < memb_off_vec_[comp + 1u]; ++idx)
+        {
+            context.match_.value_vec[memb_vec_[idx] % formula_.params_cnt] =
+                SMatch::EValue::NONE;
+        }
+    }
+}
+
+// assigns all the free params starting from the given one
+void CBinarySolver::descend(CContext& context, size_t param) const
+{
+    for (; param < formula_.params_cnt; ++param)
+    {
+        if (context.match_.value_vec[param] != SMatch::EValue::NONE)
+            continue;
+
+        bool value = model_value(param);
+        size_t trail_size = context.trail_vec_.size();
+
+        if (assign(context, lit_comp(param, value)))
+        {
+            context.decision_vec_.push_back({ param, trail_size, false });
+            continue;
+        }
+
+        // the opposite value is implied, so it is not a decision
+        rewind(context, trail_size);
+
+        [[unlikely]]
+        if (!assign(context, lit_comp(param, !value)))
+            throw CException("2-SAT residual formula became unsatisfiable");
+    }
+}
+
+// flips the deepest unflipped decision, returns false if there is none
+bool CBinarySolver::backtrack(CContext& context) const
+{
+    auto& decision_vec = context.decision_vec_;
+
+    while (!decision_vec.empty())
+    {
+        auto& decision = decision_vec.back();
+        rewind(context, decision.trail_size);
+
+        if (!decision.flipped)
+        {
+            decision.flipped = true;
+
+            size_t param = decision.param;
+            if (assign(context, lit_comp(param, !model_value(param))))
+            {
+                descend(context, param + 1u);
+                return true;
+            }
+
+            rewind(context, decision.trail_size);
+        }
+
+        decision_vec.pop_back();
+    }
+
+    return false;
+}
 
 CBinarySolver::CContext::
-CContext(std::vector<size_t>&& order_vec):
-    match_{},
-    order_vec_(std::move(order_vec))
-{}
+CContext(size_t params_cnt, size_t comp_cnt):
+    match_{ .value_vec = std::vector(params_cnt, SMatch::EValue::NONE) },
+    comp_value_vec_(comp_cnt, SMatch::EValue::NONE),
+    trail_vec_{},
+    queue_vec_{},
+    decision_vec_{}
+{
+    trail_vec_.reserve(comp_cnt);
+    decision_vec_.reserve(params_cnt);
+}
 
 SMatch 
 CBinarySolver::CContext::
@@ -137,7 +407,7 @@ match() const
 bool operator == (const CBinarySolver::CContext& lhs,
                   const CBinarySolver::CContext& rhs)
 {
-    return (lhs.match_ == rhs.match_) && (lhs.order_vec_ == rhs.order_vec_);
+    return lhs.match_ == rhs.match_;
 }
 
 bool operator != (const CBinarySolver::CContext& lhs,
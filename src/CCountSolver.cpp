@@ -0,0 +1,442 @@
+#include "CCountSolver.hpp"
+
+#include <cstdlib>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+/// @brief
+namespace tinysat {
+
+namespace {
+
+constexpr CCountSolver::TIndex NULL_IDX =
+    std::numeric_limits<CCountSolver::TIndex>::max();
+
+// positive literal is TRUE for the value 1
+constexpr uint8_t VALUE_NONE = 2u;
+
+} // namespace
+
+/**
+ * @param [in] formula SAT formula
+ * @param [in] cache_limit count of the cached components before clearing
+ */
+CCountSolver::CCountSolver(const SFormula& formula, size_t cache_limit):
+    cache_limit_(cache_limit),
+    cls_off_vec_{},
+    lit_vec_{},
+    occ_off_vec_{},
+    occ_vec_{},
+    value_vec_{},
+    trail_vec_{},
+    param_stamp_vec_{},
+    cls_stamp_vec_{},
+    score_vec_{},
+    cache_{}
+{
+    init(formula);
+}
+
+/**
+ * @return count of the models
+ *
+ * Cache is kept between the calls as the components' keys
+ * don't depend on the assignment they are met under.
+ */
+CBigUint CCountSolver::count()
+{
+    stats_ = {};
+
+    if (has_empty_)
+        return 0u;
+
+    // unit clauses are propagated before the first decomposition
+    size_t clause_cnt = cls_off_vec_.size() - 1u;
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        if (cls_off_vec_[cls + 1u] - cls_off_vec_[cls] != 1u)
+            continue;
+
+        TIndex lit = lit_vec_[cls_off_vec_[cls]];
+        uint8_t value = value_vec_[lit >> 1u];
+
+        if ((value == VALUE_NONE && !propagate(lit)) ||
+            (value != VALUE_NONE && value == (lit & 1u)))
+        {
+            rewind(0u);
+            return 0u;
+        }
+    }
+
+    std::vector<TIndex> param_vec(params_cnt_);
+    for (size_t param = 0u; param < params_cnt_; ++param)
+        param_vec[param] = static_cast<TIndex>(param);
+
+    CBigUint result = count_residual(param_vec);
+    rewind(0u);
+
+    return result;
+}
+
+/**
+ * @param [in] key component's key
+ * @return hash of the key
+ */
+size_t CCountSolver::SKeyHash::operator () (
+        const std::vector<TIndex>& key) const noexcept
+{
+    uint64_t hash = 0xcbf29ce484222325u;
+    for (TIndex word : key)
+    {
+        hash ^= word;
+        hash *= 0x100000001b3u;
+    }
+
+    return static_cast<size_t>(hash);
+}
+
+/**
+ * @param [in] formula SAT formula
+ *
+ * Duplicate literals are merged and tautologies are dropped.
+ */
+void CCountSolver::init(const SFormula& formula)
+{
+    params_cnt_ = formula.params_cnt;
+    has_empty_ = false;
+
+    [[unlikely]]
+    if (2u*params_cnt_ >= NULL_IDX)
+        throw CException("too many params for the model counting");
+
+    cls_off_vec_.assign(1u, 0u);
+    lit_vec_.clear();
+
+    std::vector<TIndex> clause;
+    for (const auto& src_clause : formula.clause_vec)
+    {
+        clause.clear();
+        for (int32_t literal : src_clause)
+        {
+            [[unlikely]]
+            if (literal == 0 || static_cast<size_t>(std::abs(literal)) >
+                                params_cnt_)
+                throw CException("literal is out of range");
+
+            clause.push_back(2u*(std::abs(literal) - 1) + (literal < 0));
+        }
+
+        std::sort(std::begin(clause), std::end(clause));
+        clause.erase(std::unique(std::begin(clause), std::end(clause)),
+                     std::end(clause));
+
+        bool tautology = false;
+        for (size_t idx = 1u; idx < clause.size(); ++idx)
+            tautology = tautology || ((clause[idx - 1u] ^ 1u) == clause[idx]);
+
+        if (tautology)
+            continue;
+
+        has_empty_ = has_empty_ || clause.empty();
+
+        lit_vec_.insert(std::end(lit_vec_),
+                        std::begin(clause), std::end(clause));
+        cls_off_vec_.push_back(static_cast<TIndex>(lit_vec_.size()));
+    }
+
+    [[unlikely]]
+    if (lit_vec_.size() >= NULL_IDX)
+        throw CException("too many literals for the model counting");
+
+    size_t clause_cnt = cls_off_vec_.size() - 1u;
+
+    occ_off_vec_.assign(params_cnt_ + 1u, 0u);
+    for (TIndex lit : lit_vec_)
+        ++occ_off_vec_[(lit >> 1u) + 1u];
+
+    for (size_t param = 0u; param < params_cnt_; ++param)
+        occ_off_vec_[param + 1u] += occ_off_vec_[param];
+
+    occ_vec_.resize(lit_vec_.size());
+
+    std::vector<TIndex> pos_vec(std::begin(occ_off_vec_),
+                                std::prev(std::end(occ_off_vec_)));
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+             ++idx)
+            occ_vec_[pos_vec[lit_vec_[idx] >> 1u]++] =
+                static_cast<TIndex>(cls);
+    }
+
+    value_vec_.assign(params_cnt_, VALUE_NONE);
+    trail_vec_.clear();
+    trail_vec_.reserve(params_cnt_);
+
+    stamp_ = 0u;
+    param_stamp_vec_.assign(params_cnt_, 0u);
+    cls_stamp_vec_.assign(clause_cnt, 0u);
+
+    score_vec_.assign(params_cnt_, 0u);
+    cache_.clear();
+}
+
+/**
+ * @param [in] lit free literal to assign true to
+ * @return false if some clause became empty
+ *
+ * Trail is the propagation queue, caller rewinds it on conflict.
+ */
+bool CCountSolver::propagate(TIndex lit)
+{
+    size_t head = trail_vec_.size();
+
+    value_vec_[lit >> 1u] = static_cast<uint8_t>((lit & 1u) ^ 1u);
+    trail_vec_.push_back(lit);
+
+    while (head < trail_vec_.size())
+    {
+        TIndex param = trail_vec_[head++] >> 1u;
+
+        for (TIndex occ = occ_off_vec_[param]; occ < occ_off_vec_[param + 1u];
+             ++occ)
+        {
+            TIndex cls = occ_vec_[occ];
+            TIndex free_lit = NULL_IDX;
+            size_t free_cnt = 0u;
+            bool satisfied = false;
+
+            for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+                 ++idx)
+            {
+                TIndex cur = lit_vec_[idx];
+                uint8_t value = value_vec_[cur >> 1u];
+
+                if (value == VALUE_NONE)
+                {
+                    free_lit = cur;
+                    ++free_cnt;
+                }
+                else if (value != (cur & 1u))
+                {
+                    satisfied = true;
+                    break;
+                }
+            }
+
+            if (satisfied || free_cnt > 1u)
+                continue;
+
+            if (free_cnt == 0u)
+                return false;
+
+            value_vec_[free_lit >> 1u] =
+                static_cast<uint8_t>((free_lit & 1u) ^ 1u);
+            trail_vec_.push_back(free_lit);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @param [in] trail_size trail size to rewind to
+ */
+void CCountSolver::rewind(size_t trail_size)
+{
+    while (trail_vec_.size() > trail_size)
+    {
+        value_vec_[trail_vec_.back() >> 1u] = VALUE_NONE;
+        trail_vec_.pop_back();
+    }
+}
+
+/**
+ * @param [in] param_vec params of the parent component
+ * @param [out] comp_vec components over the free params
+ * @return count of the free params without unsatisfied clauses
+ */
+size_t CCountSolver::decompose(const std::vector<TIndex>& param_vec,
+                               std::vector<SComponent>& comp_vec)
+{
+    ++stamp_;
+
+    size_t lone_cnt = 0u;
+    std::vector<TIndex> stack_vec;
+
+    for (TIndex root : param_vec)
+    {
+        if (value_vec_[root] != VALUE_NONE || param_stamp_vec_[root] == stamp_)
+            continue;
+
+        SComponent comp;
+
+        param_stamp_vec_[root] = stamp_;
+        stack_vec.push_back(root);
+
+        while (!stack_vec.empty())
+        {
+            TIndex param = stack_vec.back();
+            stack_vec.pop_back();
+            comp.param_vec.push_back(param);
+
+            for (TIndex occ = occ_off_vec_[param];
+                 occ < occ_off_vec_[param + 1u]; ++occ)
+            {
+                TIndex cls = occ_vec_[occ];
+                if (cls_stamp_vec_[cls] == stamp_)
+                    continue;
+
+                cls_stamp_vec_[cls] = stamp_;
+                if (is_satisfied(cls))
+                    continue;
+
+                comp.cls_vec.push_back(cls);
+                for (TIndex idx = cls_off_vec_[cls];
+                     idx < cls_off_vec_[cls + 1u]; ++idx)
+                {
+                    TIndex next = lit_vec_[idx] >> 1u;
+                    if (value_vec_[next] == VALUE_NONE &&
+                        param_stamp_vec_[next] != stamp_)
+                    {
+                        param_stamp_vec_[next] = stamp_;
+                        stack_vec.push_back(next);
+                    }
+                }
+            }
+        }
+
+        if (comp.cls_vec.empty())
+        {
+            ++lone_cnt;
+            continue;
+        }
+
+        std::sort(std::begin(comp.param_vec), std::end(comp.param_vec));
+        std::sort(std::begin(comp.cls_vec), std::end(comp.cls_vec));
+        comp_vec.push_back(std::move(comp));
+    }
+
+    return lone_cnt;
+}
+
+/**
+ * @param [in] param_vec params of the parent component
+ * @return count of the models over the free params
+ */
+CBigUint CCountSolver::count_residual(const std::vector<TIndex>& param_vec)
+{
+    std::vector<SComponent> comp_vec;
+    size_t lone_cnt = decompose(param_vec, comp_vec);
+
+    // smaller components first to meet the zero earlier
+    std::sort(std::begin(comp_vec), std::end(comp_vec),
+              [] (const SComponent& lhs, const SComponent& rhs)
+              { return lhs.cls_vec.size() < rhs.cls_vec.size(); });
+
+    CBigUint result = 1u;
+    for (const auto& comp : comp_vec)
+    {
+        CBigUint comp_cnt = count_component(comp);
+        if (comp_cnt.is_zero())
+            return 0u;
+
+        result *= comp_cnt;
+    }
+
+    result <<= lone_cnt;
+
+    return result;
+}
+
+/**
+ * @param [in] comp connected component
+ * @return count of the models over the component's params
+ */
+CBigUint CCountSolver::count_component(const SComponent& comp)
+{
+    ++stats_.components;
+
+    std::vector<TIndex> key;
+    key.reserve(comp.param_vec.size() + comp.cls_vec.size() + 1u);
+    key.insert(std::end(key),
+               std::begin(comp.param_vec), std::end(comp.param_vec));
+    key.push_back(NULL_IDX);
+    key.insert(std::end(key),
+               std::begin(comp.cls_vec), std::end(comp.cls_vec));
+
+    if (auto cache_it = cache_.find(key); cache_it != std::end(cache_))
+    {
+        ++stats_.cache_hits;
+        return cache_it->second;
+    }
+
+    // param with the most occurrences in the residual clauses
+    for (TIndex cls : comp.cls_vec)
+    {
+        for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+             ++idx)
+            ++score_vec_[lit_vec_[idx] >> 1u];
+    }
+
+    TIndex branch = comp.param_vec.front();
+    for (TIndex param : comp.param_vec)
+    {
+        if (score_vec_[branch] < score_vec_[param])
+            branch = param;
+    }
+
+    for (TIndex cls : comp.cls_vec)
+    {
+        for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+             ++idx)
+            score_vec_[lit_vec_[idx] >> 1u] = 0u;
+    }
+
+    ++stats_.decisions;
+
+    CBigUint result = 0u;
+    for (TIndex lit : { 2u*branch, 2u*branch + 1u })
+    {
+        size_t trail_size = trail_vec_.size();
+
+        if (propagate(lit))
+            result += count_residual(comp.param_vec);
+
+        rewind(trail_size);
+    }
+
+    if (cache_.size() >= cache_limit_)
+        cache_.clear();
+
+    cache_.emplace(std::move(key), result);
+
+    return result;
+}
+
+/**
+ * @param [in] cls clause
+ * @return true if some literal of the clause is TRUE
+ */
+bool CCountSolver::is_satisfied(TIndex cls) const noexcept
+{
+    for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u]; ++idx)
+    {
+        TIndex lit = lit_vec_[idx];
+        uint8_t value = value_vec_[lit >> 1u];
+
+        if (value != VALUE_NONE && value != (lit & 1u))
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace tinysat
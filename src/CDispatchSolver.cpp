@@ -0,0 +1,370 @@
+#include "CDispatchSolver.hpp"
+
+#include <cstdlib>
+
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+/// @brief
+namespace tinysat {
+
+/**
+ * @param [in] formula SAT formula to copy from
+ * @param [in] logger shared spdlog logger
+ */
+CDispatchSolver::CDispatchSolver(const SFormula& formula,
+        std::shared_ptr<spdlog::logger> logger):
+    stats_{},
+    logger_(std::move(logger)),
+    rest_solver_{},
+    horn_match_{},
+    solver_{}
+{
+    init(formula);
+}
+
+/**
+ * @param [in] formula SAT formula to move from
+ * @param [in] logger shared spdlog logger
+ */
+CDispatchSolver::CDispatchSolver(SFormula&& formula,
+        std::shared_ptr<spdlog::logger> logger):
+    stats_{},
+    logger_(std::move(logger)),
+    rest_solver_{},
+    horn_match_{},
+    solver_{}
+{
+    init(std::move(formula));
+}
+
+/**
+ * @param [in] formula SAT formula
+ * @return stats with the dispatch decision
+ */
+CDispatchSolver::SStats CDispatchSolver::analyse(const SFormula& formula)
+{
+    SStats stats = {
+        .engine = EEngine::DPLL,
+        .params_cnt = formula.params_cnt,
+        .clause_cnt = formula.clause_vec.size(),
+        .lit_cnt = 0u,
+        .max_clause_size = 0u,
+        .has_empty = false,
+        .is_horn = true,
+    };
+
+    for (const auto& clause : formula.clause_vec)
+    {
+        size_t pos_cnt = 0u;
+        for (int32_t literal : clause)
+        {
+            [[unlikely]]
+            if (literal == 0 || static_cast<size_t>(std::abs(literal)) >
+                                formula.params_cnt)
+                throw CException("literal is out of range");
+
+            pos_cnt += (literal > 0);
+        }
+
+        stats.lit_cnt += clause.size();
+        stats.max_clause_size = std::max(stats.max_clause_size, clause.size());
+        stats.has_empty = stats.has_empty || clause.empty();
+        stats.is_horn = stats.is_horn && (pos_cnt <= 1u);
+    }
+
+    stats.engine = choose(stats);
+
+    return stats;
+}
+
+/**
+ * @param [in] stats analysis results
+ * @return the fastest applicable engine
+ */
+CDispatchSolver::EEngine CDispatchSolver::choose(const SStats& stats) noexcept
+{
+    if (stats.has_empty)
+        return EEngine::UNSAT;
+
+    if (stats.max_clause_size <= 2u)
+        return EEngine::BINARY;
+
+    if (stats.is_horn)
+        return EEngine::HORN;
+
+    if (stats.params_cnt <= TINY_PARAMS_CNT)
+        return EEngine::GENERAL;
+
+    return EEngine::DPLL;
+}
+
+/**
+ * @param [in] engine engine
+ * @return engine's name
+ */
+const char* CDispatchSolver::engine_name(EEngine engine) noexcept
+{
+    switch (engine)
+    {
+        case EEngine::UNSAT: return "unsat";
+        case EEngine::BINARY: return "binary";
+        case EEngine::HORN: return "horn";
+        case EEngine::GENERAL: return "general";
+        case EEngine::DPLL: return "dpll";
+    }
+
+    return "unknown";
+}
+
+/**
+ * @param [in] formula SAT formula to copy or move from
+ */
+template<typename TFormula>
+void CDispatchSolver::init(TFormula&& formula)
+{
+    stats_ = analyse(formula);
+
+    SPDLOG_LOGGER_INFO(logger_, "CDispatchSolver::init() [engine = {}]",
+            engine_name(stats_.engine));
+
+    switch (stats_.engine)
+    {
+        case EEngine::UNSAT:
+            solver_.emplace<std::monostate>();
+            break;
+
+        case EEngine::BINARY:
+            solver_.emplace<CBinarySolver>(std::forward<TFormula>(formula));
+            break;
+
+        case EEngine::HORN:
+        {
+            const auto& solver = 
+                solver_.emplace<CHornSolver>(std::forward<TFormula>(formula));
+            if (auto context = solver.context())
+                horn_match_ = context->match();
+
+            break;
+        }
+
+        case EEngine::GENERAL:
+            solver_.emplace<CGeneralSolver>(std::forward<TFormula>(formula));
+            break;
+
+        case EEngine::DPLL:
+            solver_.emplace<CDpllSolver>(std::forward<TFormula>(formula),
+                                         logger_);
+            break;
+    }
+}
+
+/**
+ * @return unique pointer to the engine's context or nullptr
+ * @see proceed()
+ */
+std::unique_ptr<CDispatchSolver::CContext> CDispatchSolver::context() const
+{
+    return std::visit([] (const auto& solver) -> std::unique_ptr<CContext>
+        {
+            using TSolver = std::decay_t<decltype(solver)>;
+
+            if constexpr (std::is_same_v<TSolver, std::monostate>)
+            {
+                return nullptr;
+            }
+            else
+            {
+                auto context = solver.context();
+                if (context == nullptr)
+                    return nullptr;
+
+                return std::make_unique<CContext>(std::move(context));
+            }
+        },
+        solver_);
+}
+
+/**
+ * @param [in, out] context unique pointer to a context
+ * @see context()
+ */
+void CDispatchSolver::proceed(std::unique_ptr<CContext>& context) const
+{
+    if (context == nullptr)
+        throw CException("trying to proceed over the end");
+
+    if (stats_.engine == EEngine::HORN)
+    {
+        proceed_rest(context);
+        return;
+    }
+
+    bool is_end = false;
+    std::visit([&is_end] (const auto& solver, auto& inner_context)
+        {
+            using TSolver = std::decay_t<decltype(solver)>;
+            using TContextPtr = std::decay_t<decltype(inner_context)>;
+
+            if constexpr (!std::is_same_v<TSolver, std::monostate>)
+            {
+                using TSolverPtr =
+                    std::unique_ptr<typename TSolver::context_t>;
+
+                if constexpr (std::is_same_v<TContextPtr, TSolverPtr>)
+                {
+                    solver.proceed(inner_context);
+                    is_end = (inner_context == nullptr);
+                    return;
+                }
+            }
+
+            throw CException("context doesn't match the engine");
+        },
+        solver_, context->context_);
+
+    if (is_end)
+        context.reset();
+}
+
+/**
+ * @param [in, out] context unique pointer to a context
+ * @see proceed()
+ *
+ * Horn's context is replaced by DPLL's one, which skips Horn's model.
+ * DPLL engine is built from Horn's formula on the first call.
+ */
+void CDispatchSolver::proceed_rest(std::unique_ptr<CContext>& context) const
+{
+    using TDpllContextPtr = std::unique_ptr<CDpllSolver::CContext>;
+
+    if (!rest_solver_.has_value())
+        rest_solver_.emplace(std::get<CHornSolver>(solver_).formula(), logger_);
+
+    TDpllContextPtr rest_context = nullptr;
+    if (auto* dpll_context = std::get_if<TDpllContextPtr>(&context->context_))
+    {
+        rest_context = std::move(*dpll_context);
+        rest_solver_->proceed(rest_context);
+    }
+    else
+    {
+        rest_context = rest_solver_->context();
+    }
+
+    while (rest_context != nullptr && rest_context->match() == horn_match_)
+        rest_solver_->proceed(rest_context);
+
+    if (rest_context == nullptr)
+        context.reset();
+    else
+        context->context_ = std::move(rest_context);
+}
+
+/**
+ * @return iterator to the first solution
+ * @see end()
+ */
+CDispatchSolver::CIterator CDispatchSolver::begin() const
+{
+    return CIterator(this, context());
+}
+
+/**
+ * @return iterator past the last solution
+ * @see begin()
+ */
+CDispatchSolver::CIterator CDispatchSolver::end() const
+{
+    return CIterator(this, nullptr);
+}
+
+/**
+ * @param [in] context engine's context
+ */
+CDispatchSolver::CContext::CContext(TContextVariant&& context):
+    context_(std::move(context))
+{}
+
+/**
+ * @param [in] other context to copy
+ *
+ * Throws for the engines with non-copyable contexts.
+ */
+CDispatchSolver::CContext::CContext(const CContext& other):
+    context_(std::visit([] (const auto& inner_context) -> TContextVariant
+        {
+            using TContext =
+                typename std::decay_t<decltype(inner_context)>::element_type;
+
+            // DPLL context holds non-copyable backtracking lists
+            if constexpr (std::is_copy_constructible_v<TContext>)
+                return std::make_unique<TContext>(*inner_context);
+            else
+                throw CException("engine's context is not copyable");
+        },
+        other.context_))
+{}
+
+/**
+ * @param [in] other context to copy
+ * @return reference to this
+ */
+CDispatchSolver::CContext&
+CDispatchSolver::CContext::operator = (const CContext& other)
+{
+    if (this != &other)
+        *this = CContext(other);
+
+    return *this;
+}
+
+/**
+ * @return current match object
+ */
+SMatch CDispatchSolver::CContext::match() const
+{
+    return std::visit([] (const auto& inner_context)
+                      { return inner_context->match(); },
+                      context_);
+}
+
+/**
+ * @param [in] lhs one context object
+ * @param [in] rhs another context object
+ * @return true if objects are equal
+ * @see operator!=()
+ */
+bool operator == (const CDispatchSolver::CContext& lhs,
+                  const CDispatchSolver::CContext& rhs)
+{
+    if (lhs.context_.index() != rhs.context_.index())
+        return false;
+
+    return std::visit([&rhs] (const auto& lhs_context)
+        {
+            using TPtr = std::decay_t<decltype(lhs_context)>;
+            return *lhs_context == *std::get<TPtr>(rhs.context_);
+        },
+        lhs.context_);
+}
+
+/**
+ * @param [in] lhs one context object
+ * @param [in] rhs another context object
+ * @return true if objects aren't equal
+ * @see operator==()
+ */
+bool operator != (const CDispatchSolver::CContext& lhs,
+                  const CDispatchSolver::CContext& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace tinysat
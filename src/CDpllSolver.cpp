@@ -58,6 +58,146 @@ CDpllSolver::CDpllSolver(SFormula&& formula,
             static_cast<const void*>(this));
 }
 
+/**
+ * @param [in] dpll_context DPLL context to search with
+ * @param [in] capacity count of the buffered solutions
+ * @param [in] logger shared spdlog logger
+ */
+CDpllSolver::CStream::CStream(CDpllContext&& dpll_context, size_t capacity,
+        std::shared_ptr<spdlog::logger> logger):
+    dpll_context_(std::move(dpll_context)),
+    capacity_(capacity),
+    logger_(std::move(logger)),
+    stop_flag_(std::make_shared<std::atomic<bool>>(false)),
+    model_deq_(),
+    producer_()
+{
+    SPDLOG_LOGGER_INFO(logger_, "[ctor] CDpllSolver::CStream() [this = {}]", 
+            static_cast<const void*>(this));
+
+    [[unlikely]]
+    if (capacity_ == 0u)
+        throw CException("stream capacity must be positive");
+
+    dpll_context_.limits().set_stop_flag(stop_flag_);
+    producer_ = std::thread(&CStream::work, this);
+}
+
+CDpllSolver::CStream::~CStream()
+{
+    close();
+    producer_.join();
+}
+
+/**
+ * @return next solution or nullopt if there are no more of them
+ * @see try_pop()
+ */
+std::optional<SMatch> CDpllSolver::CStream::pop()
+{
+    std::unique_lock lock(mutex_);
+    pop_cv_.wait(lock, [this] { return finished_ || !model_deq_.empty(); });
+
+    if (model_deq_.empty())
+        return std::nullopt;
+
+    SMatch model = std::move(model_deq_.front());
+    model_deq_.pop_front();
+
+    lock.unlock();
+    push_cv_.notify_one();
+
+    return model;
+}
+
+/**
+ * @return next solution or nullopt if it isn't found yet
+ * @see pop()
+ * @see done()
+ */
+std::optional<SMatch> CDpllSolver::CStream::try_pop()
+{
+    std::unique_lock lock(mutex_);
+    if (model_deq_.empty())
+        return std::nullopt;
+
+    SMatch model = std::move(model_deq_.front());
+    model_deq_.pop_front();
+
+    lock.unlock();
+    push_cv_.notify_one();
+
+    return model;
+}
+
+/**
+ * @return true if the producer has finished and the queue is empty
+ */
+bool CDpllSolver::CStream::done() const
+{
+    std::lock_guard lock(mutex_);
+    return finished_ && model_deq_.empty();
+}
+
+/**
+ * Doesn't wait for the producer, it finishes on its own.
+ */
+void CDpllSolver::CStream::close()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stop_flag_->store(true, std::memory_order_relaxed);
+    }
+
+    push_cv_.notify_all();
+}
+
+/**
+ * Search is done without holding the lock.
+ */
+void CDpllSolver::CStream::work()
+{
+    for (bool found = dpll_context_.init(); found; 
+         found = dpll_context_.next())
+    {
+        SMatch model = dpll_context_.match();
+
+        std::unique_lock lock(mutex_);
+        push_cv_.wait(lock, [this] 
+                      { 
+                          return model_deq_.size() < capacity_ || 
+                                 stop_flag_->load(std::memory_order_relaxed);
+                      });
+
+        if (stop_flag_->load(std::memory_order_relaxed))
+            break;
+
+        model_deq_.push_back(std::move(model));
+
+        lock.unlock();
+        pop_cv_.notify_one();
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        finished_ = true;
+    }
+
+    pop_cv_.notify_all();
+}
+
+/**
+ * @return DPLL context with the projection and proof set
+ */
+CDpllContext CDpllSolver::dpll_context() const
+{
+    CDpllContext dpll_context(formula_);
+    dpll_context.set_projection(projection_vec_);
+    dpll_context.set_proof(proof_);
+
+    return dpll_context;
+}
+
 /**
  * @return unique pointer to the constructed context
  * @see proceed()
@@ -67,6 +207,9 @@ std::unique_ptr<CDpllSolver::CContext> CDpllSolver::context() const
     SPDLOG_LOGGER_INFO(logger_, "CDpllSolver::context()");
 
     auto context = std::make_unique<CContext>(formula_, logger_);
+    context->dpll_context_.set_projection(projection_vec_);
+    context->dpll_context_.set_proof(proof_);
+
     if (context->dpll_context_.init() == false)
         context.reset();
 
@@ -88,6 +231,70 @@ void CDpllSolver::proceed(std::unique_ptr<CContext>& context) const
         context.reset();
 }
 
+/**
+ * @param [in] stop_flag flag to interrupt the search or nullptr
+ * @return future of the first solution, nullopt if there are no solutions
+ *         or the search is interrupted
+ * @see stream()
+ *
+ * Search runs in its own thread and doesn't refer to the solver,
+ * so the solver may be destroyed before the future is ready.
+ * Proof, if set, mustn't be shared with the concurrent searches.
+ */
+std::future<std::optional<SMatch>> 
+CDpllSolver::solve_async(std::shared_ptr<std::atomic<bool>> stop_flag) const
+{
+    SPDLOG_LOGGER_INFO(logger_, "CDpllSolver::solve_async()");
+
+    CDpllContext context = dpll_context();
+    context.limits().set_stop_flag(std::move(stop_flag));
+
+    return std::async(std::launch::async, 
+                      [context = std::move(context)] () mutable
+                      -> std::optional<SMatch>
+                      {
+                          if (!context.init())
+                              return std::nullopt;
+
+                          return context.match();
+                      });
+}
+
+/**
+ * @param [in] capacity count of the solutions found ahead of the consumer
+ * @return unique pointer to the started stream
+ * @see solve_async()
+ */
+std::unique_ptr<CDpllSolver::CStream> CDpllSolver::stream(size_t capacity) const
+{
+    SPDLOG_LOGGER_INFO(logger_, "CDpllSolver::stream()");
+
+    return std::make_unique<CStream>(dpll_context(), capacity, logger_);
+}
+
+/**
+ * @return generator yielding references to the solutions
+ * @see CDpllContext::models()
+ *
+ * Generator owns its context, so it may outlive the solver.
+ */
+CGenerator<const SMatch&> CDpllSolver::models() const
+{
+    SPDLOG_LOGGER_INFO(logger_, "CDpllSolver::models()");
+
+    return generate(dpll_context());
+}
+
+/**
+ * @param [in] dpll_context context moved into the coroutine's frame
+ * @return generator yielding references to the solutions
+ */
+CGenerator<const SMatch&> CDpllSolver::generate(CDpllContext dpll_context)
+{
+    for (const SMatch& model : dpll_context.models())
+        co_yield model;
+}
+
 /**
  * @return iterator to the first solution
  * @see end()
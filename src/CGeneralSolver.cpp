@@ -1,7 +1,27 @@
 #include "CGeneralSolver.hpp"
 
+#include <algorithm>
+#include <bit>
+
 namespace tinysat {
 
+namespace {
+
+// lane masks of the lowest parameters being TRUE,
+// parameter is FALSE in the lane iff the lane's corresponding bit is set
+constexpr uint64_t LANE_PARAM_MASKS[] = {
+    0x5555555555555555ull,
+    0x3333333333333333ull,
+    0x0F0F0F0F0F0F0F0Full,
+    0x00FF00FF00FF00FFull,
+    0x0000FFFF0000FFFFull,
+    0x00000000FFFFFFFFull,
+};
+
+static_assert(std::size(LANE_PARAM_MASKS) == CGeneralSolver::LANE_LOG);
+
+} // namespace
+
 CGeneralSolver::CGeneralSolver(const SFormula& formula)
 {
     reset(formula);
@@ -12,6 +32,20 @@ CGeneralSolver::CGeneralSolver(SFormula&& formula)
     reset(std::move(formula));
 }
 
+CGeneralSolver::CGeneralSolver(const SFormula& formula, 
+                               std::shared_ptr<CThreadPool> thread_pool):
+    thread_pool_(std::move(thread_pool))
+{
+    reset(formula);
+}
+
+CGeneralSolver::CGeneralSolver(SFormula&& formula, 
+                               std::shared_ptr<CThreadPool> thread_pool):
+    thread_pool_(std::move(thread_pool))
+{
+    reset(std::move(formula));
+}
+
 void CGeneralSolver::reset(const SFormula& formula)
 {
     formula_ = formula;
@@ -32,8 +66,30 @@ std::unique_ptr<CGeneralSolver::CContext> CGeneralSolver::context() const
     };
 
     auto result = std::make_unique<CContext>(std::move(match));
+    result->limits_ = limits_;
+
+    auto& param_mask_vec = result->param_mask_vec_;
+    param_mask_vec.assign(formula_.params_cnt, ~TLaneMask{ 0u });
+    for (size_t param = 0u; 
+         param < LANE_LOG && param < formula_.params_cnt; ++param)
+    {
+        param_mask_vec[param] = LANE_PARAM_MASKS[param];
+    }
+
+    if (block_cnt_ != 0u)
+    {
+        fill_window(*result, 0u);
+        result->lane_mask_ = result->window_vec_.front();
+    }
+    else
+    {
+        result->lane_mask_ = evaluate(param_mask_vec.data(), 
+                                      result->watch_cls_);
+    }
 
-    if (!formula_.is_match(result->match()) && !propagate(*result))
+    if (result->lane_mask_ != 0u)
+        set_lane(*result, std::countr_zero(result->lane_mask_));
+    else if (!propagate(*result) && result->status_ != EStatus::UNKNOWN)
         result.reset();
 
     return std::move(result);
@@ -45,13 +101,34 @@ void CGeneralSolver::proceed(std::unique_ptr<CContext>& context) const
     if (context == nullptr)
         throw CException("trying to proceed over the end");
 
+    // iteration can't report the interruption, so it just ends
     if (!propagate(*context))
         context.reset();
 }
 
+EStatus CGeneralSolver::resume(std::unique_ptr<CContext>& context) const
+{
+    [[unlikely]]
+    if (context == nullptr)
+        throw CException("trying to resume over the end");
+
+    // interrupted context is kept to be resumed by the next call
+    propagate(*context);
+
+    const EStatus status = context->status_;
+    if (status == EStatus::UNSAT)
+        context.reset();
+
+    return status;
+}
+
 CGeneralSolver::CIterator CGeneralSolver::begin() const
 {
-    return CIterator(this, context());
+    auto result = context();
+    if (result != nullptr && result->status_ == EStatus::UNKNOWN)
+        result.reset();
+
+    return CIterator(this, std::move(result));
 }
 
 CGeneralSolver::CIterator CGeneralSolver::end() const
@@ -61,30 +138,250 @@ CGeneralSolver::CIterator CGeneralSolver::end() const
 
 void CGeneralSolver::init()
 {
+    size_t lane_log = std::min(formula_.params_cnt, LANE_LOG);
+    valid_mask_ = (lane_log == LANE_LOG ? 
+                   ~TLaneMask{ 0u } : (TLaneMask{ 1u } << (1u << lane_log)) - 1u);
+
+    lit_vec_.clear();
+    cls_off_vec_.clear();
+    cls_off_vec_.reserve(formula_.clause_vec.size() + 1u);
+    cls_off_vec_.push_back(0u);
+
+    // parallel mode needs the block index to fit into 64 bits
+    block_cnt_ = 0u;
+    if (thread_pool_ && formula_.params_cnt < LANE_LOG + 64u)
+    {
+        block_cnt_ = (formula_.params_cnt <= LANE_LOG ? 1u : 
+                      uint64_t{ 1u } << (formula_.params_cnt - LANE_LOG));
+    }
+
+    for (const auto& clause : formula_.clause_vec)
+    {
+        for (int32_t lit : clause)
+        {
+            size_t param = static_cast<size_t>(lit < 0 ? -lit : lit) - 1u;
+
+            [[unlikely]]
+            if (lit == 0 || formula_.params_cnt <= param)
+                throw CException("literal is out of the formula's range");
+
+            lit_vec_.push_back(SBitLiteral {
+                .param = param,
+                .flip = (lit < 0 ? ~TLaneMask{ 0u } : TLaneMask{ 0u })
+            });
+        }
+
+        cls_off_vec_.push_back(lit_vec_.size());
+    }
 }
 
+// Candidates are enumerated in blocks of LANE_CNT assignments:
+// the lowest LANE_LOG parameters vary inside of the block (bit-sliced)
+// and the rest ones are incremented like a binary counter between blocks.
+// Models are produced in the same order as by a plain binary counter.
+// Limits are polled once per block, the interrupted search has
+// the empty lane mask, so the next call continues from the same block.
 bool CGeneralSolver::propagate(CContext& context) const
 {
-    do
+    if (block_cnt_ != 0u)
+        return propagate_parallel(context);
+
+    // drop the current lane
+    context.lane_mask_ &= context.lane_mask_ - 1u;
+
+    while (context.lane_mask_ == 0u)
     {
-        size_t idx = 0u;
-        while (idx < formula_.params_cnt && 
-               context.match_.value_vec[idx] == SMatch::EValue::FALSE)
+        if (context.limits_.exhausted())
         {
-            context.match_.value_vec[idx] = SMatch::EValue::TRUE;
-            ++idx;
+            context.status_ = EStatus::UNKNOWN;
+            return false;
         }
 
-        if (idx == formula_.params_cnt)
+        if (!next_block(context))
+        {
+            context.status_ = EStatus::UNSAT;
             return false;
+        }
 
-        context.match_.value_vec[idx] = SMatch::EValue::FALSE;
+        context.limits_.on_propagation();
+        context.lane_mask_ = evaluate(context.param_mask_vec_.data(), 
+                                      context.watch_cls_);
     }
-    while (!formula_.is_match(context.match_));
+
+    set_lane(context, std::countr_zero(context.lane_mask_));
+    context.status_ = EStatus::SAT;
 
     return true;
 }
 
+// Parallel mode evaluates windows of consecutive blocks on the pool
+// and consumes them in order, so models' order is the same as sequential.
+bool CGeneralSolver::propagate_parallel(CContext& context) const
+{
+    bool block_changed = false;
+    context.lane_mask_ &= context.lane_mask_ - 1u;
+
+    while (context.lane_mask_ == 0u)
+    {
+        if (context.limits_.exhausted())
+        {
+            context.status_ = EStatus::UNKNOWN;
+            return false;
+        }
+
+        if (++context.window_idx_ == context.window_vec_.size())
+        {
+            uint64_t next_base = context.window_base_ + 
+                                 context.window_vec_.size();
+            if (next_base >= block_cnt_)
+            {
+                context.status_ = EStatus::UNSAT;
+                return false;
+            }
+
+            fill_window(context, next_base);
+        }
+
+        context.limits_.on_propagation();
+        context.lane_mask_ = context.window_vec_[context.window_idx_];
+        block_changed = true;
+    }
+
+    if (block_changed)
+        set_block(context, context.window_base_ + context.window_idx_);
+
+    set_lane(context, std::countr_zero(context.lane_mask_));
+    context.status_ = EStatus::SAT;
+
+    return true;
+}
+
+bool CGeneralSolver::next_block(CContext& context) const
+{
+    size_t idx = LANE_LOG;
+    while (idx < formula_.params_cnt && 
+           context.match_.value_vec[idx] == SMatch::EValue::FALSE)
+    {
+        context.match_.value_vec[idx] = SMatch::EValue::TRUE;
+        context.param_mask_vec_[idx] = ~TLaneMask{ 0u };
+        ++idx;
+    }
+
+    if (idx >= formula_.params_cnt)
+        return false;
+
+    context.match_.value_vec[idx] = SMatch::EValue::FALSE;
+    context.param_mask_vec_[idx] = TLaneMask{ 0u };
+
+    return true;
+}
+
+void CGeneralSolver::fill_window(CContext& context, uint64_t base) const
+{
+    uint64_t window_cnt = std::min<uint64_t>(
+        block_cnt_ - base, 
+        thread_pool_->size()*WORKER_TASK_CNT*TASK_BLOCK_CNT);
+
+    context.window_base_ = base;
+    context.window_idx_ = 0u;
+    context.window_vec_.resize(window_cnt);
+
+    size_t task_cnt = (window_cnt + TASK_BLOCK_CNT - 1u)/TASK_BLOCK_CNT;
+    auto* window = context.window_vec_.data();
+
+    thread_pool_->run(task_cnt, 
+        [this, base, window, window_cnt] (size_t task_idx, size_t)
+        {
+            uint64_t beg = task_idx*TASK_BLOCK_CNT;
+            uint64_t end = std::min<uint64_t>(beg + TASK_BLOCK_CNT, 
+                                              window_cnt);
+
+            std::vector<TLaneMask> param_mask_vec(formula_.params_cnt);
+            for (size_t param = 0u; param < formula_.params_cnt; ++param)
+            {
+                if (param < LANE_LOG)
+                    param_mask_vec[param] = LANE_PARAM_MASKS[param];
+                else
+                    param_mask_vec[param] = 
+                        ((base + beg) >> (param - LANE_LOG)) & 1u ? 
+                        TLaneMask{ 0u } : ~TLaneMask{ 0u };
+            }
+
+            size_t watch_cls = NULL_CLS;
+            for (uint64_t idx = beg; idx < end; ++idx)
+            {
+                window[idx] = evaluate(param_mask_vec.data(), watch_cls);
+
+                // flip the parameters changed by the block increment
+                uint64_t block = base + idx;
+                for (uint64_t diff = block ^ (block + 1u); diff != 0u; 
+                     diff &= diff - 1u)
+                {
+                    size_t param = LANE_LOG + std::countr_zero(diff);
+                    if (param < formula_.params_cnt)
+                        param_mask_vec[param] = ~param_mask_vec[param];
+                }
+            }
+        });
+}
+
+// Consecutive blocks differ in a few parameters, so the clause
+// falsifying the previous block is checked first: it usually
+// stays falsified and the block is rejected in O(clause) time.
+CGeneralSolver::TLaneMask 
+CGeneralSolver::evaluate(const TLaneMask* param_masks, 
+                         size_t& watch_cls) const
+{
+    if (watch_cls != NULL_CLS && eval_clause(param_masks, watch_cls) == 0u)
+        return TLaneMask{ 0u };
+
+    TLaneMask result = valid_mask_;
+    size_t cls_cnt = cls_off_vec_.size() - 1u;
+    for (size_t cls = 0u; cls < cls_cnt; ++cls)
+    {
+        result &= eval_clause(param_masks, cls);
+
+        if (result == 0u)
+        {
+            watch_cls = cls;
+            break;
+        }
+    }
+
+    return result;
+}
+
+CGeneralSolver::TLaneMask 
+CGeneralSolver::eval_clause(const TLaneMask* param_masks, size_t cls) const
+{
+    TLaneMask cls_mask = 0u;
+    for (size_t idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u]; ++idx)
+        cls_mask |= param_masks[lit_vec_[idx].param] ^ lit_vec_[idx].flip;
+
+    return cls_mask & valid_mask_;
+}
+
+void CGeneralSolver::set_block(CContext& context, uint64_t block) const
+{
+    for (size_t param = LANE_LOG; param < formula_.params_cnt; ++param)
+    {
+        context.match_.value_vec[param] = 
+            ((block >> (param - LANE_LOG)) & 1u ?
+             SMatch::EValue::FALSE : SMatch::EValue::TRUE);
+    }
+}
+
+void CGeneralSolver::set_lane(CContext& context, size_t lane) const
+{
+    for (size_t param = 0u; 
+         param < LANE_LOG && param < formula_.params_cnt; ++param)
+    {
+        context.match_.value_vec[param] = ((lane >> param) & 1u ?
+                                           SMatch::EValue::FALSE :
+                                           SMatch::EValue::TRUE);
+    }
+}
+
 /*
     SFormula formula_;
 */
@@ -109,7 +406,7 @@ match() const
 bool operator == (const CGeneralSolver::CContext& lhs,
                   const CGeneralSolver::CContext& rhs)
 {
-    return lhs.match_ == rhs.match_;
+    return (lhs.match_ == rhs.match_) && (lhs.lane_mask_ == rhs.lane_mask_);
 }
 
 bool operator != (const CGeneralSolver::CContext& lhs,
@@ -0,0 +1,360 @@
+#include "CHornSolver.hpp"
+
+#include "CBinarySolver.hpp"
+
+namespace tinysat {
+
+CHornSolver::CHornSolver(const SFormula& formula):
+    formula_{},
+    flip_vec_{},
+    match_{}
+{
+    reset(formula);
+}
+
+CHornSolver::CHornSolver(SFormula&& formula):
+    formula_{},
+    flip_vec_{},
+    match_{}
+{
+    reset(std::move(formula));
+}
+
+CHornSolver::CHornSolver(const SFormula& formula, 
+                         std::vector<bool> flip_vec):
+    formula_{},
+    flip_vec_{},
+    match_{}
+{
+    reset(formula, std::move(flip_vec));
+}
+
+CHornSolver::CHornSolver(SFormula&& formula, std::vector<bool> flip_vec):
+    formula_{},
+    flip_vec_{},
+    match_{}
+{
+    reset(std::move(formula), std::move(flip_vec));
+}
+
+void CHornSolver::reset(const SFormula& formula)
+{
+    formula_ = formula;
+    flip_vec_.clear();
+    init();
+}
+
+void CHornSolver::reset(SFormula&& formula)
+{
+    formula_ = std::move(formula);
+    flip_vec_.clear();
+    init();
+}
+
+void CHornSolver::reset(const SFormula& formula, std::vector<bool> flip_vec)
+{
+    formula_ = formula;
+    flip_vec_ = std::move(flip_vec);
+    init();
+}
+
+void CHornSolver::reset(SFormula&& formula, std::vector<bool> flip_vec)
+{
+    formula_ = std::move(formula);
+    flip_vec_ = std::move(flip_vec);
+    init();
+}
+
+std::unique_ptr<CHornSolver::CContext>
+CHornSolver::context() const
+{
+    if (!satisfiable_)
+        return nullptr;
+
+    return std::make_unique<CContext>(match_);
+}
+
+void CHornSolver::proceed(std::unique_ptr<CContext>& context) const
+{
+    [[unlikely]]
+    if (context == nullptr)
+        throw CException("trying to proceed over the end");
+
+    context = nullptr;
+}
+
+CHornSolver::CIterator CHornSolver::begin() const
+{
+    return CIterator(this, context());
+}
+
+CHornSolver::CIterator CHornSolver::end() const
+{
+    return CIterator(this, nullptr);
+}
+
+bool CHornSolver::is_horn(const SFormula& formula)
+{
+    for (const auto& clause : formula.clause_vec)
+    {
+        size_t pos_cnt = 0u;
+        for (int32_t literal : clause)
+            pos_cnt += (literal > 0);
+
+        if (pos_cnt > 1u)
+            return false;
+    }
+
+    return true;
+}
+
+CHornSolver::EHornKind CHornSolver::detect(const SFormula& formula)
+{
+    if (is_horn(formula))
+        return EHornKind::HORN;
+
+    if (find_renaming(formula).has_value())
+        return EHornKind::RENAMABLE;
+
+    return EHornKind::NONE;
+}
+
+// 2-SAT over the flip params: at most one literal of every clause
+// is positive after the renaming. Sequential encoding of the constraint
+// uses one auxiliary param per literal, so the formula stays linear.
+std::optional<std::vector<bool>>
+CHornSolver::find_renaming(const SFormula& formula)
+{
+    size_t params_cnt = formula.params_cnt;
+
+    size_t aux_cnt = 0u;
+    for (const auto& clause : formula.clause_vec)
+        aux_cnt += (clause.size() > 1u ? clause.size() - 1u : 0u);
+
+    SFormula rename_formula = {
+        .params_cnt = params_cnt + aux_cnt,
+        .clause_vec = {}
+    };
+    rename_formula.clause_vec.reserve(3u*aux_cnt);
+
+    // literal is positive after the renaming iff its param is not flipped
+    auto positive = [] (int32_t literal) { return -literal; };
+
+    int32_t aux_next = static_cast<int32_t>(params_cnt) + 1;
+    for (const auto& clause : formula.clause_vec)
+    {
+        if (clause.size() < 2u)
+            continue;
+
+        // aux_i is TRUE if some of the first i + 1 literals is positive
+        for (size_t idx = 0u; idx + 1u < clause.size(); ++idx)
+        {
+            int32_t aux = aux_next + static_cast<int32_t>(idx);
+            int32_t pos = positive(clause[idx]);
+
+            rename_formula.clause_vec.push_back({ -pos, aux });
+            if (idx > 0u)
+                rename_formula.clause_vec.push_back({ -(aux - 1), aux });
+        }
+
+        for (size_t idx = 1u; idx < clause.size(); ++idx)
+        {
+            int32_t aux = aux_next + static_cast<int32_t>(idx) - 1;
+            int32_t pos = positive(clause[idx]);
+
+            rename_formula.clause_vec.push_back({ -pos, -aux });
+        }
+
+        aux_next += static_cast<int32_t>(clause.size()) - 1;
+    }
+
+    auto rename_solver = CBinarySolver(std::move(rename_formula));
+    auto rename_it = rename_solver.begin();
+
+    if (rename_it == rename_solver.end())
+        return std::nullopt;
+
+    SMatch rename_match = *rename_it;
+
+    std::vector<bool> result(params_cnt);
+    for (size_t param = 0u; param < params_cnt; ++param)
+    {
+        result[param] = 
+            (rename_match.value_vec[param] == SMatch::EValue::TRUE);
+    }
+
+    return result;
+}
+
+void CHornSolver::init()
+{
+    for (const auto& clause : formula_.clause_vec)
+    {
+        for (int32_t literal : clause)
+        {
+            [[unlikely]]
+            if (literal == 0 || static_cast<size_t>(std::abs(literal)) >
+                                formula_.params_cnt)
+                throw CException("literal is out of range");
+        }
+    }
+
+    // given renaming is only checked, it is linear unlike the search
+    if (!flip_vec_.empty() || formula_.params_cnt == 0u)
+    {
+        [[unlikely]]
+        if (flip_vec_.size() != formula_.params_cnt)
+            throw CException("renaming doesn't match the formula");
+
+        for (const auto& clause : formula_.clause_vec)
+        {
+            size_t pos_cnt = 0u;
+            for (int32_t literal : clause)
+                pos_cnt += ((literal > 0) != flip_vec_[std::abs(literal) - 1]);
+
+            [[unlikely]]
+            if (pos_cnt > 1u)
+                throw CException("Horn solver initialized with non-Horn");
+        }
+    }
+    else if (is_horn(formula_))
+    {
+        flip_vec_.assign(formula_.params_cnt, false);
+    }
+    else
+    {
+        auto renaming = find_renaming(formula_);
+
+        [[unlikely]]
+        if (!renaming.has_value())
+            throw CException("Horn solver initialized with non-Horn");
+
+        flip_vec_ = std::move(*renaming);
+    }
+
+    propagate();
+}
+
+// Dowling-Gallier: every clause counts its body literals not yet TRUE,
+// the head is set once the counter drops to zero
+void CHornSolver::propagate()
+{
+    size_t params_cnt = formula_.params_cnt;
+    size_t clause_cnt = formula_.clause_vec.size();
+
+    std::vector<size_t> cnt_vec(clause_cnt, 0u);
+    std::vector<size_t> head_vec(clause_cnt, NULL_HEAD);
+
+    // clauses containing the param in the body in the CSR form
+    std::vector<size_t> occ_off_vec(params_cnt + 1u, 0u);
+    std::vector<size_t> occ_vec;
+
+    auto is_head = [this] (int32_t literal)
+    {
+        return (literal > 0) != flip_vec_[std::abs(literal) - 1];
+    };
+
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        for (int32_t literal : formula_.clause_vec[cls])
+        {
+            size_t param = std::abs(literal) - 1;
+            if (is_head(literal))
+            {
+                head_vec[cls] = param;
+            }
+            else
+            {
+                ++cnt_vec[cls];
+                ++occ_off_vec[param + 1u];
+            }
+        }
+    }
+
+    for (size_t param = 0u; param < params_cnt; ++param)
+        occ_off_vec[param + 1u] += occ_off_vec[param];
+
+    occ_vec.resize(occ_off_vec.back());
+
+    std::vector<size_t> pos_vec(std::begin(occ_off_vec),
+                                std::prev(std::end(occ_off_vec)));
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        for (int32_t literal : formula_.clause_vec[cls])
+        {
+            if (!is_head(literal))
+                occ_vec[pos_vec[std::abs(literal) - 1]++] = cls;
+        }
+    }
+
+    std::vector<bool> value_vec(params_cnt, false);
+    std::vector<size_t> queue_vec;
+    queue_vec.reserve(params_cnt);
+
+    satisfiable_ = true;
+
+    auto fire = [this, &value_vec, &queue_vec, &head_vec] (size_t cls)
+    {
+        if (head_vec[cls] == NULL_HEAD)
+            satisfiable_ = false;
+        else if (!value_vec[head_vec[cls]])
+        {
+            value_vec[head_vec[cls]] = true;
+            queue_vec.push_back(head_vec[cls]);
+        }
+    };
+
+    for (size_t cls = 0u; cls < clause_cnt && satisfiable_; ++cls)
+    {
+        if (cnt_vec[cls] == 0u)
+            fire(cls);
+    }
+
+    while (!queue_vec.empty() && satisfiable_)
+    {
+        size_t param = queue_vec.back();
+        queue_vec.pop_back();
+
+        for (size_t idx = occ_off_vec[param];
+             idx < occ_off_vec[param + 1u] && satisfiable_; ++idx)
+        {
+            size_t cls = occ_vec[idx];
+            if (--cnt_vec[cls] == 0u)
+                fire(cls);
+        }
+    }
+
+    match_.value_vec.resize(params_cnt);
+    for (size_t param = 0u; param < params_cnt; ++param)
+    {
+        match_.value_vec[param] = (value_vec[param] != flip_vec_[param] ?
+                                   SMatch::EValue::TRUE :
+                                   SMatch::EValue::FALSE);
+    }
+}
+
+CHornSolver::CContext::
+CContext(const SMatch& match):
+    match_(match)
+{}
+
+SMatch
+CHornSolver::CContext::
+match() const
+{
+    return match_;
+}
+
+bool operator == (const CHornSolver::CContext& lhs,
+                  const CHornSolver::CContext& rhs)
+{
+    return lhs.match_ == rhs.match_;
+}
+
+bool operator != (const CHornSolver::CContext& lhs,
+                  const CHornSolver::CContext& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace tinysat
@@ -0,0 +1,415 @@
+#include "CLocalSolver.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @file
+ * @author geome_try
+ * @date 2020
+ */
+
+/// @brief
+namespace tinysat {
+
+namespace {
+
+constexpr CLocalSolver::TIndex NULL_IDX =
+    std::numeric_limits<CLocalSolver::TIndex>::max();
+
+} // namespace
+
+/**
+ * @param [in] formula SAT formula
+ * @param [in] params search parameters
+ */
+CLocalSolver::CLocalSolver(const SFormula& formula,
+                           const SLocalParams& params):
+    params_(params),
+    cls_off_vec_{},
+    lit_vec_{},
+    occ_off_vec_{},
+    occ_vec_{},
+    prob_vec_{}
+{
+    init(formula);
+}
+
+/**
+ * @return unique pointer to the context with the model or nullptr
+ * @see proceed()
+ */
+std::unique_ptr<CLocalSolver::CContext> CLocalSolver::context() const
+{
+    if (has_empty_)
+        return nullptr;
+
+    auto result = std::make_unique<CContext>();
+    result->gen_.seed(params_.seed);
+
+    result->value_vec_.resize(params_cnt_);
+    for (auto& value : result->value_vec_)
+        value = static_cast<uint8_t>(result->gen_() & 1u);
+
+    restart(*result);
+    if (!walk(*result))
+        return nullptr;
+
+    return result;
+}
+
+/**
+ * @param [in, out] context unique pointer to the context
+ * @see context()
+ */
+void CLocalSolver::proceed(std::unique_ptr<CContext>& context) const
+{
+    [[unlikely]]
+    if (context == nullptr)
+        throw CException("trying to proceed over the end");
+
+    if (params_cnt_ == 0u)
+    {
+        context = nullptr;
+        return;
+    }
+
+    // leave the current model by a random flip
+    std::vector<uint8_t> prev_vec = context->value_vec_;
+    uint64_t budget_end = context->flips_ + params_.max_flips;
+
+    do
+    {
+        flip(*context, static_cast<TIndex>(
+            context->gen_.below(params_cnt_)));
+
+        if (!walk(*context) || context->flips_ >= budget_end)
+        {
+            context = nullptr;
+            return;
+        }
+    }
+    while (context->value_vec_ == prev_vec);
+}
+
+/**
+ * @return iterator to the first solution
+ * @see end()
+ */
+CLocalSolver::CIterator CLocalSolver::begin() const
+{
+    return CIterator(this, context());
+}
+
+/**
+ * @return iterator past the last solution
+ * @see begin()
+ */
+CLocalSolver::CIterator CLocalSolver::end() const
+{
+    return CIterator(this, nullptr);
+}
+
+/**
+ * @param [in] formula SAT formula
+ *
+ * Duplicate literals are merged and tautologies are dropped,
+ * so XOR of TRUE params identifies the critical param.
+ */
+void CLocalSolver::init(const SFormula& formula)
+{
+    params_cnt_ = formula.params_cnt;
+    has_empty_ = false;
+
+    [[unlikely]]
+    if (2u*params_cnt_ >= NULL_IDX)
+        throw CException("too many params for the local search");
+
+    cls_off_vec_.assign(1u, 0u);
+    lit_vec_.clear();
+
+    std::vector<TIndex> clause;
+    for (const auto& src_clause : formula.clause_vec)
+    {
+        clause.clear();
+        for (int32_t literal : src_clause)
+        {
+            [[unlikely]]
+            if (literal == 0 || static_cast<size_t>(std::abs(literal)) >
+                                params_cnt_)
+                throw CException("literal is out of range");
+
+            clause.push_back(2u*(std::abs(literal) - 1) + (literal < 0));
+        }
+
+        std::sort(std::begin(clause), std::end(clause));
+        clause.erase(std::unique(std::begin(clause), std::end(clause)),
+                     std::end(clause));
+
+        bool tautology = false;
+        for (size_t idx = 1u; idx < clause.size(); ++idx)
+            tautology = tautology || ((clause[idx - 1u] ^ 1u) == clause[idx]);
+
+        if (tautology)
+            continue;
+
+        has_empty_ = has_empty_ || clause.empty();
+
+        lit_vec_.insert(std::end(lit_vec_),
+                        std::begin(clause), std::end(clause));
+        cls_off_vec_.push_back(static_cast<TIndex>(lit_vec_.size()));
+    }
+
+    [[unlikely]]
+    if (lit_vec_.size() >= NULL_IDX)
+        throw CException("too many literals for the local search");
+
+    size_t clause_cnt = cls_off_vec_.size() - 1u;
+
+    occ_off_vec_.assign(2u*params_cnt_ + 1u, 0u);
+    for (TIndex lit : lit_vec_)
+        ++occ_off_vec_[lit + 1u];
+
+    for (size_t lit = 0u; lit < 2u*params_cnt_; ++lit)
+        occ_off_vec_[lit + 1u] += occ_off_vec_[lit];
+
+    occ_vec_.resize(lit_vec_.size());
+
+    std::vector<TIndex> pos_vec(std::begin(occ_off_vec_),
+                                std::prev(std::end(occ_off_vec_)));
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+             ++idx)
+            occ_vec_[pos_vec[lit_vec_[idx]]++] = static_cast<TIndex>(cls);
+    }
+
+    prob_vec_.resize(MAX_BREAK);
+    for (size_t brk = 0u; brk < MAX_BREAK; ++brk)
+        prob_vec_[brk] = std::pow(params_.cb, -static_cast<double>(brk));
+}
+
+/**
+ * @param [in, out] context context with the assignment
+ */
+void CLocalSolver::restart(CContext& context) const
+{
+    size_t clause_cnt = cls_off_vec_.size() - 1u;
+
+    context.break_vec_.assign(params_cnt_, 0u);
+    context.true_vec_.assign(clause_cnt, { 0u, 0u });
+    context.unsat_vec_.clear();
+    context.unsat_pos_vec_.assign(clause_cnt, NULL_IDX);
+
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        for (TIndex idx = cls_off_vec_[cls]; idx < cls_off_vec_[cls + 1u];
+             ++idx)
+        {
+            TIndex lit = lit_vec_[idx];
+            TIndex param = lit >> 1u;
+
+            // positive literal is TRUE for the value 1
+            if (context.value_vec_[param] != (lit & 1u))
+            {
+                ++context.true_vec_[cls].cnt;
+                context.true_vec_[cls].xor_param ^= param;
+            }
+        }
+
+        if (context.true_vec_[cls].cnt == 0u)
+        {
+            context.unsat_pos_vec_[cls] =
+                static_cast<TIndex>(context.unsat_vec_.size());
+            context.unsat_vec_.push_back(static_cast<TIndex>(cls));
+        }
+        else if (context.true_vec_[cls].cnt == 1u)
+        {
+            ++context.break_vec_[context.true_vec_[cls].xor_param];
+        }
+    }
+}
+
+/**
+ * @param [in, out] context context to walk from
+ * @return true if all the clauses are satisfied
+ */
+bool CLocalSolver::walk(CContext& context) const
+{
+    uint64_t budget_end = context.flips_ + params_.max_flips;
+
+    while (!context.unsat_vec_.empty())
+    {
+        if (context.flips_ >= budget_end)
+            return false;
+
+        TIndex cls = context.unsat_vec_[
+            context.gen_.below(context.unsat_vec_.size())];
+        flip(context, pick(context, cls));
+    }
+
+    return true;
+}
+
+/**
+ * @param [in, out] context context holding the random generator
+ * @param [in] cls unsatisfied clause
+ * @return param to flip
+ */
+CLocalSolver::TIndex CLocalSolver::pick(CContext& context, TIndex cls) const
+{
+    const TIndex* beg = lit_vec_.data() + cls_off_vec_[cls];
+    const TIndex* end = lit_vec_.data() + cls_off_vec_[cls + 1u];
+    size_t size = end - beg;
+
+    auto param_break = [&context] (TIndex lit)
+    {
+        return context.break_vec_[lit >> 1u];
+    };
+
+    if (params_.policy == ELocalPolicy::WALKSAT)
+    {
+        const TIndex* best = beg;
+        for (const TIndex* cur = beg; cur != end; ++cur)
+        {
+            if (param_break(*cur) < param_break(*best))
+                best = cur;
+        }
+
+        if (param_break(*best) != 0u && 
+            context.gen_.unit() < params_.noise)
+            return beg[context.gen_.below(size)] >> 1u;
+
+        return *best >> 1u;
+    }
+
+    context.score_vec_.resize(size);
+
+    double sum = 0.0;
+    for (size_t idx = 0u; idx < size; ++idx)
+    {
+        sum += prob_vec_[std::min<size_t>(param_break(beg[idx]),
+                                          MAX_BREAK - 1u)];
+        context.score_vec_[idx] = sum;
+    }
+
+    double point = context.gen_.unit()*sum;
+    for (size_t idx = 0u; idx + 1u < size; ++idx)
+    {
+        if (point < context.score_vec_[idx])
+            return beg[idx] >> 1u;
+    }
+
+    return beg[size - 1u] >> 1u;
+}
+
+/**
+ * @param [in, out] context context to update
+ * @param [in] param param to flip
+ */
+void CLocalSolver::flip(CContext& context, TIndex param) const
+{
+    ++context.flips_;
+    context.value_vec_[param] ^= 1u;
+
+    // positive literal 2*param becomes TRUE for the value 1
+    TIndex true_lit = 2u*param + (context.value_vec_[param] ^ 1u);
+    TIndex false_lit = true_lit ^ 1u;
+
+    auto& true_vec = context.true_vec_;
+    auto& break_vec = context.break_vec_;
+
+    for (TIndex idx = occ_off_vec_[true_lit];
+         idx < occ_off_vec_[true_lit + 1u]; ++idx)
+    {
+        auto& data = true_vec[occ_vec_[idx]];
+        TIndex cnt = data.cnt++;
+
+        if (cnt == 0u)
+        {
+            // remove from the unsat list by the swap with the last one
+            TIndex cls = occ_vec_[idx];
+            TIndex pos = context.unsat_pos_vec_[cls];
+            TIndex last = context.unsat_vec_.back();
+
+            context.unsat_vec_[pos] = last;
+            context.unsat_pos_vec_[last] = pos;
+            context.unsat_vec_.pop_back();
+            context.unsat_pos_vec_[cls] = NULL_IDX;
+
+            ++break_vec[param];
+        }
+        else if (cnt == 1u)
+        {
+            --break_vec[data.xor_param];
+        }
+
+        data.xor_param ^= param;
+    }
+
+    for (TIndex idx = occ_off_vec_[false_lit];
+         idx < occ_off_vec_[false_lit + 1u]; ++idx)
+    {
+        auto& data = true_vec[occ_vec_[idx]];
+        TIndex cnt = --data.cnt;
+        data.xor_param ^= param;
+
+        if (cnt == 0u)
+        {
+            TIndex cls = occ_vec_[idx];
+            context.unsat_pos_vec_[cls] =
+                static_cast<TIndex>(context.unsat_vec_.size());
+            context.unsat_vec_.push_back(cls);
+
+            --break_vec[param];
+        }
+        else if (cnt == 1u)
+        {
+            ++break_vec[data.xor_param];
+        }
+    }
+}
+
+/**
+ * @return current match
+ */
+SMatch CLocalSolver::CContext::match() const
+{
+    SMatch result = { .value_vec = std::vector<SMatch::EValue>(
+        value_vec_.size(), SMatch::EValue::FALSE) };
+
+    for (size_t param = 0u; param < value_vec_.size(); ++param)
+    {
+        if (value_vec_[param])
+            result.value_vec[param] = SMatch::EValue::TRUE;
+    }
+
+    return result;
+}
+
+/**
+ * @param [in] lhs one context object
+ * @param [in] rhs another context object
+ * @return true if objects are equal
+ */
+bool operator == (const CLocalSolver::CContext& lhs,
+                  const CLocalSolver::CContext& rhs)
+{
+    return (lhs.value_vec_ == rhs.value_vec_) && (lhs.flips_ == rhs.flips_);
+}
+
+/**
+ * @param [in] lhs one context object
+ * @param [in] rhs another context object
+ * @return true if objects aren't equal
+ */
+bool operator != (const CLocalSolver::CContext& lhs,
+                  const CLocalSolver::CContext& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace tinysat
@@ -0,0 +1,436 @@
+#include "CXorSolver.hpp"
+
+#include <bit>
+#include <map>
+#include <algorithm>
+
+namespace tinysat {
+
+CXorSolver::CXorSolver(const SXorFormula& formula):
+    formula_{},
+    row_vec_{},
+    pivot_vec_{},
+    free_vec_{},
+    dep_off_vec_{},
+    dep_vec_{}
+{
+    reset(formula);
+}
+
+CXorSolver::CXorSolver(SXorFormula&& formula):
+    formula_{},
+    row_vec_{},
+    pivot_vec_{},
+    free_vec_{},
+    dep_off_vec_{},
+    dep_vec_{}
+{
+    reset(std::move(formula));
+}
+
+CXorSolver::CXorSolver(const SFormula& formula):
+    formula_{},
+    row_vec_{},
+    pivot_vec_{},
+    free_vec_{},
+    dep_off_vec_{},
+    dep_vec_{}
+{
+    auto xor_formula = extract(formula);
+
+    [[unlikely]]
+    if (!xor_formula.has_value())
+        throw CException("XOR solver initialized with non-XOR");
+
+    reset(std::move(*xor_formula));
+}
+
+void CXorSolver::reset(const SXorFormula& formula)
+{
+    formula_ = formula;
+    init();
+}
+
+void CXorSolver::reset(SXorFormula&& formula)
+{
+    formula_ = std::move(formula);
+    init();
+}
+
+std::unique_ptr<CXorSolver::CContext>
+CXorSolver::context() const
+{
+    if (!satisfiable_)
+        return nullptr;
+
+    // free params are FALSE, so pivots are equal to the rhs
+    SMatch match = {
+        .value_vec = std::vector(formula_.params_cnt, SMatch::EValue::FALSE)
+    };
+
+    size_t rhs = formula_.params_cnt;
+    for (size_t row = 0u; row < pivot_vec_.size(); ++row)
+    {
+        TWord word = row_vec_[row*row_words_ + (rhs >> WORD_LOG)];
+        if ((word >> (rhs % WORD_BITS)) & 1u)
+            match.value_vec[pivot_vec_[row]] = SMatch::EValue::TRUE;
+    }
+
+    return std::make_unique<CContext>(match);
+}
+
+void CXorSolver::proceed(std::unique_ptr<CContext>& context) const
+{
+    [[unlikely]]
+    if (context == nullptr)
+        throw CException("trying to proceed over the end");
+
+    size_t free_cnt = free_vec_.size();
+    if (free_cnt < WORD_BITS && context->step_ + 1u == (1ull << free_cnt))
+    {
+        context = nullptr;
+        return;
+    }
+
+    ++context->step_;
+    flip(*context, std::countr_zero(context->step_));
+}
+
+CXorSolver::CIterator CXorSolver::begin() const
+{
+    return CIterator(this, context());
+}
+
+CXorSolver::CIterator CXorSolver::end() const
+{
+    return CIterator(this, nullptr);
+}
+
+// XOR clause over k params is encoded with 2^(k-1) clauses forbidding
+// the assignments of the wrong parity, every clause has the same params
+// and the parity of its negations determines the parity of XOR
+std::optional<SXorFormula> CXorSolver::extract(const SFormula& formula)
+{
+    SXorFormula result = { 
+        .params_cnt = formula.params_cnt, 
+        .clause_vec = {} 
+    };
+
+    // sign masks seen for the set of params
+    std::map<std::vector<int32_t>, std::vector<bool>> group_map;
+
+    for (const auto& clause : formula.clause_vec)
+    {
+        if (clause.empty())
+        {
+            result.clause_vec.push_back({});
+            continue;
+        }
+
+        if (clause.size() > MAX_EXTRACT_SIZE)
+            return std::nullopt;
+
+        std::vector<int32_t> param_vec(clause.size());
+        std::transform(std::begin(clause), std::end(clause),
+                       std::begin(param_vec),
+                       [] (int32_t literal) { return std::abs(literal); });
+        std::sort(std::begin(param_vec), std::end(param_vec));
+
+        if (std::adjacent_find(std::begin(param_vec), std::end(param_vec)) !=
+            std::end(param_vec))
+            return std::nullopt;
+
+        size_t mask = 0u;
+        for (int32_t literal : clause)
+        {
+            if (literal < 0)
+            {
+                size_t pos = std::lower_bound(std::begin(param_vec),
+                                              std::end(param_vec),
+                                              -literal) -
+                             std::begin(param_vec);
+                mask |= (1u << pos);
+            }
+        }
+
+        auto& seen_vec = group_map[std::move(param_vec)];
+        if (seen_vec.empty())
+            seen_vec.resize(1u << clause.size(), false);
+
+        seen_vec[mask] = true;
+    }
+
+    for (const auto& [param_vec, seen_vec] : group_map)
+    {
+        // seen counts for the even and the odd parity of negations
+        size_t seen_cnt[2u] = {};
+        for (size_t mask = 0u; mask < seen_vec.size(); ++mask)
+            seen_cnt[std::popcount(mask) % 2u] += seen_vec[mask];
+
+        for (size_t parity = 0u; parity < 2u; ++parity)
+        {
+            if (seen_cnt[parity] == 0u)
+                continue;
+
+            if (seen_cnt[parity] != seen_vec.size()/2u)
+                return std::nullopt;
+
+            // even negations forbid the even assignments, so XOR is TRUE
+            std::vector<int32_t> xor_clause = param_vec;
+            if (parity == 1u)
+                xor_clause[0u] = -xor_clause[0u];
+
+            result.clause_vec.push_back(std::move(xor_clause));
+        }
+    }
+
+    return result;
+}
+
+void CXorSolver::init()
+{
+    size_t params_cnt = formula_.params_cnt;
+    size_t clause_cnt = formula_.clause_vec.size();
+
+    row_words_ = (params_cnt + 1u + WORD_BITS - 1u) >> WORD_LOG;
+    row_vec_.assign(clause_cnt*row_words_, 0u);
+
+    for (size_t row = 0u; row < clause_cnt; ++row)
+    {
+        TWord* row_ptr = row_vec_.data() + row*row_words_;
+
+        // XOR of literals is TRUE: every negation flips the rhs
+        size_t rhs = 1u;
+        for (int32_t literal : formula_.clause_vec[row])
+        {
+            [[unlikely]]
+            if (literal == 0 || static_cast<size_t>(std::abs(literal)) >
+                                params_cnt)
+                throw CException("literal is out of range");
+
+            size_t param = std::abs(literal) - 1;
+            row_ptr[param >> WORD_LOG] ^= (TWord{1u} << (param % WORD_BITS));
+            rhs ^= (literal < 0);
+        }
+
+        row_ptr[params_cnt >> WORD_LOG] ^=
+            (TWord{rhs} << (params_cnt % WORD_BITS));
+    }
+
+    eliminate();
+}
+
+void CXorSolver::eliminate()
+{
+    size_t params_cnt = formula_.params_cnt;
+    size_t clause_cnt = formula_.clause_vec.size();
+
+    auto row_ptr = [this] (size_t row)
+    {
+        return row_vec_.data() + row*row_words_;
+    };
+
+    auto test = [] (const TWord* row, size_t col)
+    {
+        return (row[col >> WORD_LOG] >> (col % WORD_BITS)) & 1u;
+    };
+
+    pivot_vec_.clear();
+    free_vec_.clear();
+
+    std::vector<size_t> free_idx_vec(params_cnt, 0u);
+    std::vector<bool> is_pivot_vec(params_cnt, false);
+
+    auto xor_row = [this] (TWord* dst, const TWord* src, size_t beg_word)
+    {
+        for (size_t word = beg_word; word < row_words_; ++word)
+            dst[word] ^= src[word];
+    };
+
+    // combinations of the block pivots, see the Method of Four Russians
+    std::vector<TWord> table_vec((1u << BLOCK_PIVOTS)*row_words_, 0u);
+    std::vector<size_t> block_vec;
+
+    size_t rank = 0u;
+    size_t col = 0u;
+    while (col < params_cnt)
+    {
+        // block pivots lie in the same word, so candidates are reduced
+        // by them in this single word until the pivot is found
+        size_t beg_word = col >> WORD_LOG;
+        size_t end_col = std::min(params_cnt, (beg_word + 1u) << WORD_LOG);
+        size_t beg_rank = rank;
+
+        auto reduced_word = [&] (size_t row)
+        {
+            TWord result = row_ptr(row)[beg_word];
+            for (size_t idx = 0u; idx < block_vec.size(); ++idx)
+            {
+                if ((result >> (block_vec[idx] % WORD_BITS)) & 1u)
+                    result ^= row_ptr(beg_rank + idx)[beg_word];
+            }
+
+            return result;
+        };
+
+        block_vec.clear();
+        for (; col < end_col && block_vec.size() < BLOCK_PIVOTS; ++col)
+        {
+            size_t pivot = rank;
+            while (pivot < clause_cnt)
+            {
+                TWord word = reduced_word(pivot);
+                if ((word >> (col % WORD_BITS)) & 1u)
+                    break;
+
+                ++pivot;
+            }
+
+            if (pivot == clause_cnt)
+            {
+                free_idx_vec[col] = free_vec_.size();
+                free_vec_.push_back(col);
+                continue;
+            }
+
+            TWord* src = row_ptr(pivot);
+            for (size_t idx = 0u; idx < block_vec.size(); ++idx)
+            {
+                if (test(src, block_vec[idx]))
+                    xor_row(src, row_ptr(beg_rank + idx), beg_word);
+            }
+
+            if (pivot != rank)
+            {
+                std::swap_ranges(row_ptr(pivot), row_ptr(pivot) + row_words_,
+                                 row_ptr(rank));
+            }
+
+            // keeps the block pivots reduced against each other
+            for (size_t idx = 0u; idx < block_vec.size(); ++idx)
+            {
+                if (test(row_ptr(beg_rank + idx), col))
+                    xor_row(row_ptr(beg_rank + idx), row_ptr(rank), beg_word);
+            }
+
+            block_vec.push_back(col);
+            is_pivot_vec[col] = true;
+            pivot_vec_.push_back(col);
+            ++rank;
+        }
+
+        if (block_vec.empty())
+            continue;
+
+        size_t comb_cnt = 1u << block_vec.size();
+        for (size_t comb = 1u; comb < comb_cnt; ++comb)
+        {
+            TWord* dst = table_vec.data() + comb*row_words_;
+            const TWord* prev = 
+                table_vec.data() + (comb & (comb - 1u))*row_words_;
+            const TWord* src = row_ptr(beg_rank + std::countr_zero(comb));
+
+            for (size_t word = beg_word; word < row_words_; ++word)
+                dst[word] = prev[word] ^ src[word];
+        }
+
+        // single row operation per row instead of one per pivot
+        for (size_t row = 0u; row < clause_cnt; ++row)
+        {
+            if (row == beg_rank)
+                row = rank;
+
+            if (row >= clause_cnt)
+                break;
+
+            TWord* dst = row_ptr(row);
+
+            size_t comb = 0u;
+            for (size_t idx = 0u; idx < block_vec.size(); ++idx)
+                comb |= (test(dst, block_vec[idx]) << idx);
+
+            if (comb != 0u)
+                xor_row(dst, table_vec.data() + comb*row_words_, beg_word);
+        }
+    }
+
+    // remaining rows are zero, nonzero rhs means 0 == 1
+    satisfiable_ = true;
+    for (size_t row = rank; row < clause_cnt && satisfiable_; ++row)
+        satisfiable_ = !test(row_ptr(row), params_cnt);
+
+    dep_off_vec_.assign(free_vec_.size() + 1u, 0u);
+    dep_vec_.clear();
+
+    auto visit_free = [this, &row_ptr, &is_pivot_vec, params_cnt, rank]
+                      (auto&& func)
+    {
+        for (size_t row = 0u; row < rank; ++row)
+        {
+            const TWord* ptr = row_ptr(row);
+            for (size_t word = 0u; word < row_words_; ++word)
+            {
+                for (TWord bits = ptr[word]; bits != 0u; bits &= bits - 1u)
+                {
+                    size_t col = (word << WORD_LOG) + std::countr_zero(bits);
+                    if (col < params_cnt && !is_pivot_vec[col])
+                        func(col, row);
+                }
+            }
+        }
+    };
+
+    visit_free([this, &free_idx_vec] (size_t col, size_t row)
+               { ++dep_off_vec_[free_idx_vec[col] + 1u]; });
+
+    for (size_t idx = 0u; idx < free_vec_.size(); ++idx)
+        dep_off_vec_[idx + 1u] += dep_off_vec_[idx];
+
+    dep_vec_.resize(dep_off_vec_.back());
+
+    std::vector<size_t> pos_vec(std::begin(dep_off_vec_),
+                                std::prev(std::end(dep_off_vec_)));
+    visit_free([this, &free_idx_vec, &pos_vec] (size_t col, size_t row)
+               { dep_vec_[pos_vec[free_idx_vec[col]]++] = pivot_vec_[row]; });
+}
+
+void CXorSolver::flip(CContext& context, size_t free_idx) const
+{
+    auto toggle = [&context] (size_t param)
+    {
+        auto& value = context.match_.value_vec[param];
+        value = (value == SMatch::EValue::TRUE ?
+                 SMatch::EValue::FALSE : SMatch::EValue::TRUE);
+    };
+
+    toggle(free_vec_[free_idx]);
+    for (size_t idx = dep_off_vec_[free_idx];
+         idx < dep_off_vec_[free_idx + 1u]; ++idx)
+        toggle(dep_vec_[idx]);
+}
+
+CXorSolver::CContext::
+CContext(const SMatch& match):
+    match_(match)
+{}
+
+SMatch
+CXorSolver::CContext::
+match() const
+{
+    return match_;
+}
+
+bool operator == (const CXorSolver::CContext& lhs,
+                  const CXorSolver::CContext& rhs)
+{
+    return (lhs.match_ == rhs.match_) && (lhs.step_ == rhs.step_);
+}
+
+bool operator != (const CXorSolver::CContext& lhs,
+                  const CXorSolver::CContext& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace tinysat
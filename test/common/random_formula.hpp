@@ -0,0 +1,94 @@
+#ifndef TINYSAT_TEST_COMMON_RANDOM_FORMULA_HPP_
+#define TINYSAT_TEST_COMMON_RANDOM_FORMULA_HPP_
+
+#include <cstdint>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "SFormula.hpp"
+#include "SMatch.hpp"
+
+namespace tinysat::test {
+
+// Random clause of clause_size literals over params_cnt params
+//
+// Distinct clause has no repeated params, so it has exactly
+// clause_size literals and requires clause_size <= params_cnt.
+//
+inline std::vector<int32_t> random_clause(std::mt19937& gen, 
+                                          size_t params_cnt,
+                                          size_t clause_size, 
+                                          bool distinct = false)
+{
+    std::vector<int32_t> clause;
+    while (clause.size() < clause_size)
+    {
+        int32_t param = 1 + static_cast<int32_t>(gen() % params_cnt);
+        if (distinct && 
+            (std::find(std::begin(clause), std::end(clause), param) != 
+                 std::end(clause) ||
+             std::find(std::begin(clause), std::end(clause), -param) != 
+                 std::end(clause)))
+            continue;
+
+        clause.push_back(gen() % 2u ? param : -param);
+    }
+
+    return clause;
+}
+
+// Random formula with the clauses' sizes in [min_size, max_size]
+//
+// Requirements:
+// - TFormula is SFormula or SXorFormula
+//
+template<typename TFormula = SFormula>
+TFormula random_formula(std::mt19937& gen, size_t params_cnt, 
+                        size_t clause_cnt, size_t min_size, size_t max_size,
+                        bool distinct = false)
+{
+    TFormula formula = { .params_cnt = params_cnt, .clause_vec = {} };
+    for (size_t cls = 0u; cls < clause_cnt; ++cls)
+    {
+        size_t clause_size = min_size + gen() % (max_size - min_size + 1u);
+        formula.clause_vec.push_back(
+                random_clause(gen, params_cnt, clause_size, distinct));
+    }
+
+    return formula;
+}
+
+// All models of the formula by the brute force
+//
+// Models go in the order of the binary counter over the params,
+// the set bit meaning FALSE, so all-TRUE model is the first one.
+//
+template<typename TFormula>
+std::vector<SMatch> brute_force(const TFormula& formula)
+{
+    std::vector<SMatch> result;
+    SMatch match = { 
+        .value_vec = std::vector(formula.params_cnt, SMatch::EValue::TRUE) 
+    };
+
+    for (size_t mask = 0u; (mask >> formula.params_cnt) == 0u; ++mask)
+    {
+        for (size_t param = 0u; param < formula.params_cnt; ++param)
+        {
+            match.value_vec[param] = ((mask >> param) & 1u ? 
+                                      SMatch::EValue::FALSE : 
+                                      SMatch::EValue::TRUE);
+        }
+
+        if (formula.is_match(match))
+            result.push_back(match);
+    }
+
+    return result;
+}
+
+} // namespace tinysat::test
+
+#endif // TINYSAT_TEST_COMMON_RANDOM_FORMULA_HPP_
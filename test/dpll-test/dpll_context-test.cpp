@@ -1,10 +1,19 @@
 #include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
 
 #include "include/CDpllContext.hpp"
+#include "include/CDpllProofChecker.hpp"
+
+#include "common/random_formula.hpp"
 
 #include "gtest/gtest.h"
 
 using namespace tinysat;
+using namespace tinysat::test;
 
 TEST(DpllContextTest, proceed)
 {
@@ -23,3 +32,420 @@ TEST(DpllContextTest, proceed)
     ASSERT_EQ(context.init(), true);
     ASSERT_EQ(context.next(), true);
 }
+
+TEST(DpllContextTest, lookahead)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 200u; ++test)
+    {
+        // ratio around 4.3 to get both satisfiable and unsatisfiable cases
+        size_t params_cnt = 4u + gen() % 9u;
+        auto formula = random_formula(gen, params_cnt, 
+                4u*params_cnt + gen() % params_cnt, 3u, 3u, true);
+
+        bool expected = !brute_force(formula).empty();
+
+        // tiny budget checks the fallback to the heap in the middle
+        CDpllContext context(formula);
+        context.set_decision(CDpllContext::EDecision::LOOKAHEAD, 
+                             4u, test % 2u ? 2u : 
+                             CDpllLookahead::DEFAULT_NODE_BUDGET);
+
+        ASSERT_EQ(context.init(), expected);
+        if (expected)
+        {
+            ASSERT_TRUE(formula.is_match(context.match()));
+        }
+    }
+}
+
+TEST(DpllContextTest, assumptions)
+{
+    std::mt19937 gen(2020u);
+
+    // assumptions are unit clauses of the formula
+    auto satisfiable = [] (SFormula formula, 
+                           const std::vector<int>& assumptions)
+    {
+        for (int lit : assumptions)
+            formula.clause_vec.push_back({ lit });
+
+        return !brute_force(formula).empty();
+    };
+
+    for (size_t test = 0u; test < 50u; ++test)
+    {
+        size_t params_cnt = 6u + gen() % 5u;
+        auto formula = random_formula(gen, params_cnt, 2u*params_cnt, 
+                                      3u, 3u, true);
+
+        // single context lives through all the calls
+        CDpllContext context(formula);
+        if (test % 2u)
+            context.set_decision(CDpllContext::EDecision::LOOKAHEAD);
+
+        for (size_t call = 0u; call < 10u; ++call)
+        {
+            if (gen() % 2u)
+            {
+                auto clause = random_clause(gen, params_cnt, 3u, true);
+                formula.clause_vec.push_back(clause);
+                context.add_clause(clause);
+            }
+
+            std::vector<int> assumptions;
+            for (size_t idx = gen() % 5u; idx > 0u; --idx)
+            {
+                int param = 1 + static_cast<int>(gen() % formula.params_cnt);
+                assumptions.push_back(gen() % 2u ? param : -param);
+            }
+
+            bool expected = satisfiable(formula, assumptions);
+            ASSERT_EQ(context.solve(assumptions), expected);
+
+            if (expected)
+            {
+                ASSERT_TRUE(formula.is_match(context.match()));
+                for (int lit : assumptions)
+                    ASSERT_EQ(context.match().value_vec[std::abs(lit) - 1],
+                              lit > 0 ? SMatch::EValue::TRUE : 
+                                        SMatch::EValue::FALSE);
+            }
+            else
+            {
+                for (int lit : context.core())
+                    ASSERT_NE(std::find(std::begin(assumptions), 
+                                        std::end(assumptions), lit),
+                              std::end(assumptions));
+
+                ASSERT_FALSE(satisfiable(formula, context.core()));
+            }
+        }
+    }
+}
+
+TEST(DpllContextTest, projection)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 100u; ++test)
+    {
+        size_t params_cnt = 3u + gen() % 8u;
+        auto formula = random_formula(gen, params_cnt, 
+                                      gen() % (3u*params_cnt), 1u, 3u, true);
+
+        std::vector<int> projection;
+        for (size_t param = 1u; param <= formula.params_cnt; ++param)
+        {
+            if (gen() % 2u)
+                projection.push_back(static_cast<int>(param));
+        }
+
+        // empty projection means no projection at all
+        if (projection.empty())
+            projection.push_back(1);
+
+        auto project = [&projection] (const SMatch& match)
+        {
+            std::vector<SMatch::EValue> result;
+            for (int param : projection)
+                result.push_back(match.value_vec[param - 1]);
+
+            return result;
+        };
+
+        std::set<std::vector<SMatch::EValue>> expected;
+        for (const auto& match : brute_force(formula))
+            expected.insert(project(match));
+
+        CDpllContext context(formula);
+        context.set_projection(projection);
+
+        std::set<std::vector<SMatch::EValue>> result;
+        for (bool found = context.init(); found; found = context.next())
+        {
+            ASSERT_TRUE(formula.is_match(context.match()));
+            ASSERT_TRUE(result.insert(project(context.match())).second);
+        }
+
+        ASSERT_EQ(result, expected);
+    }
+}
+
+TEST(DpllContextTest, proof)
+{
+    std::mt19937 gen(2020u);
+
+    size_t unsat_cnt = 0u;
+    for (size_t test = 0u; test < 100u; ++test)
+    {
+        // ratio 6 is mostly unsatisfiable
+        size_t params_cnt = 4u + gen() % 7u;
+        auto formula = random_formula(gen, params_cnt, 6u*params_cnt, 
+                                      3u, 3u, true);
+
+        auto format = (test % 2u ? CDpllProof::EFormat::TEXT :
+                                   CDpllProof::EFormat::BINARY);
+
+        std::stringstream stream;
+        bool satisfiable = false;
+        {
+            // tiny buffer checks the hand-off to the writer
+            auto proof = std::make_shared<CDpllProof>(stream, format, 16u);
+
+            CDpllContext context(formula);
+            context.set_proof(proof);
+            satisfiable = context.init();
+        }
+
+        if (satisfiable)
+            continue;
+
+        ++unsat_cnt;
+
+        CDpllProofChecker checker(formula);
+        ASSERT_TRUE(checker.check(stream, format));
+        ASSERT_GT(checker.lemmas(), 0u);
+    }
+
+    ASSERT_GT(unsat_cnt, 50u);
+
+    size_t sat_cnt = 0u;
+    for (size_t test = 0u; test < 100u; ++test)
+    {
+        // ratio 3 is mostly satisfiable
+        size_t params_cnt = 4u + gen() % 7u;
+        auto formula = random_formula(gen, params_cnt, 3u*params_cnt,
+                                      3u, 3u, true);
+
+        std::stringstream stream;
+        size_t models_cnt = 0u;
+        {
+            auto proof = std::make_shared<CDpllProof>(
+                stream, CDpllProof::EFormat::TEXT);
+
+            CDpllContext context(formula);
+            context.set_proof(proof);
+            for ([[maybe_unused]] const SMatch& model : context.models())
+                ++models_cnt;
+        }
+
+        // refutation is checked above
+        if (models_cnt == 0u)
+            continue;
+
+        ++sat_cnt;
+
+        // subtrees with the models aren't refuted, so no lemmas follow them
+        size_t lemma_cnt = 0u;
+        for (std::string line; std::getline(stream, line);)
+            lemma_cnt += (line.empty() || line.front() != 'd');
+
+        // formula's clause is RUP, it is reached iff all the lemmas are
+        stream.clear();
+        for (int lit : formula.clause_vec.front())
+            stream << lit << ' ';
+        stream << "0\n";
+        stream.seekg(0);
+
+        CDpllProofChecker checker(formula);
+        ASSERT_FALSE(checker.check(stream, CDpllProof::EFormat::TEXT));
+        ASSERT_EQ(checker.lemmas(), lemma_cnt + 1u);
+    }
+
+    ASSERT_GT(sat_cnt, 50u);
+
+    // unit clause 1 isn't RUP for the formula
+    SFormula formula = { .params_cnt = 2u, .clause_vec = { { 1, 2 } } };
+    std::stringstream stream("1 0\n0\n");
+
+    CDpllProofChecker checker(formula);
+    ASSERT_FALSE(checker.check(stream, CDpllProof::EFormat::TEXT));
+}
+
+TEST(DpllContextTest, reset)
+{
+    SFormula unsat_formula = {
+        .params_cnt = 2u,
+        .clause_vec = { { 1, 2 }, { 1, -2 }, { -1, 2 }, { -1, -2 } }
+    };
+
+    SFormula sat_formula = {
+        .params_cnt = 3u,
+        .clause_vec = { { 1, 2, 3 }, { -1, -2 }, { -3 } }
+    };
+
+    std::stringstream stream;
+    auto proof = std::make_shared<CDpllProof>(stream, 
+                                              CDpllProof::EFormat::TEXT);
+
+    CDpllContext context(unsat_formula);
+    context.set_proof(proof);
+    ASSERT_FALSE(context.init());
+    ASSERT_EQ(context.status(), EStatus::UNSAT);
+
+    context.limits().set_decision_budget(0u);
+    ASSERT_FALSE(context.init());
+    ASSERT_EQ(context.status(), EStatus::UNKNOWN);
+
+    // reset context is the same as the new one
+    std::weak_ptr<CDpllProof> weak_proof = proof;
+    proof.reset();
+
+    context.reset(sat_formula);
+    ASSERT_TRUE(weak_proof.expired());
+    ASSERT_EQ(context.status(), EStatus::UNKNOWN);
+    ASSERT_EQ(context.limits().decisions(), 0u);
+
+    ASSERT_TRUE(context.init());
+    ASSERT_TRUE(sat_formula.is_match(context.match()));
+}
+
+TEST(DpllContextTest, limits)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 100u; ++test)
+    {
+        // ratio around 4.3 to get both satisfiable and unsatisfiable cases
+        size_t params_cnt = 6u + gen() % 7u;
+        auto formula = random_formula(gen, params_cnt, 
+                4u*params_cnt + gen() % params_cnt, 3u, 3u, true);
+
+        std::vector<SMatch> expected_vec;
+        CDpllContext expected(formula);
+        for (bool found = expected.init(); found; found = expected.next())
+            expected_vec.push_back(expected.match());
+
+        ASSERT_EQ(expected.status(), EStatus::UNSAT);
+
+        // search is interrupted after every single decision and resumed
+        std::vector<SMatch> result_vec;
+        size_t unknown_cnt = 0u;
+
+        CDpllContext context(formula);
+        context.limits().set_decision_budget(1u);
+
+        bool found = context.init();
+        while (found || context.status() == EStatus::UNKNOWN)
+        {
+            if (found)
+                result_vec.push_back(context.match());
+            else
+                ++unknown_cnt;
+
+            context.limits().set_decision_budget(1u);
+            found = context.next();
+        }
+
+        ASSERT_EQ(context.status(), EStatus::UNSAT);
+        ASSERT_EQ(result_vec, expected_vec);
+        ASSERT_EQ(context.limits().decisions(), 
+                  expected.limits().decisions());
+        ASSERT_GT(unknown_cnt, 0u);
+    }
+
+    SFormula formula = { .params_cnt = 2u, .clause_vec = { { 1, 2 } } };
+
+    // raised stop flag interrupts the search before the first decision
+    auto stop_flag = std::make_shared<std::atomic<bool>>(true);
+    CDpllContext stopped(formula);
+    stopped.limits().set_stop_flag(stop_flag);
+    ASSERT_FALSE(stopped.init());
+    ASSERT_EQ(stopped.status(), EStatus::UNKNOWN);
+
+    stop_flag->store(false);
+    ASSERT_TRUE(stopped.next());
+    ASSERT_EQ(stopped.status(), EStatus::SAT);
+
+    CDpllContext expired(formula);
+    expired.limits().set_deadline(CLimits::TClock::now());
+    ASSERT_FALSE(expired.solve({}));
+    ASSERT_EQ(expired.status(), EStatus::UNKNOWN);
+    ASSERT_TRUE(expired.core().empty());
+}
+
+TEST(DpllContextTest, models)
+{
+    SFormula formula = {
+        .params_cnt = 9u,
+        .clause_vec = {
+            { -1, 2, 5 },
+            { 1, 3 },
+            { 2, 5, -8 },
+            { -3, 4, -5 },
+            { 7, -9 },
+            { -6, 8 },
+        }
+    };
+
+    std::vector<SMatch> expected_vec;
+    CDpllContext expected(formula);
+    for (bool found = expected.init(); found; found = expected.next())
+        expected_vec.push_back(expected.match());
+
+    CDpllContext context(formula);
+
+    std::vector<SMatch> result_vec;
+    for (const SMatch& model : context.models())
+    {
+        // yielded model is the context's own match
+        ASSERT_EQ(&model, &context.match());
+        result_vec.push_back(model);
+    }
+
+    ASSERT_EQ(result_vec, expected_vec);
+    ASSERT_EQ(context.status(), EStatus::UNSAT);
+
+    // abandoned generator leaves the context to be continued
+    CDpllContext partial(formula);
+    {
+        auto models = partial.models();
+        ASSERT_NE(models.begin(), models.end());
+    }
+
+    ASSERT_EQ(partial.match(), expected_vec.front());
+    ASSERT_TRUE(partial.next());
+    ASSERT_EQ(partial.match(), expected_vec[1u]);
+}
+
+TEST(DpllLiteralTest, encode)
+{
+    for (int lit : { 1, -1, 2, -2, 1000, -1000, (1 << 30), -(1 << 30) })
+    {
+        auto code = SDpllLiteral::from_int(lit);
+
+        ASSERT_EQ(code.to_int(), lit);
+        ASSERT_EQ((~code).to_int(), -lit);
+        ASSERT_EQ(code.param(), static_cast<size_t>(std::abs(lit)) - 1u);
+        ASSERT_EQ(code.value(), 
+                  lit > 0 ? SMatch::EValue::TRUE : SMatch::EValue::FALSE);
+    }
+
+    // literals of the same param are adjacent
+    ASSERT_EQ(SDpllLiteral::from_int(3).idx() + 1u, 
+              SDpllLiteral::from_int(-3).idx());
+    ASSERT_LT(SDpllLiteral::from_int(-3), SDpllLiteral::from_int(4));
+}
+
+TEST(DpllLookaheadTest, reset)
+{
+    SFormula formula = {
+        .params_cnt = 4u,
+        .clause_vec = { { 1, 2, 3 }, { -1, -2, 4 }, { -3, -4, 1 } }
+    };
+
+    CDpllFormula dpll_formula(formula);
+    CDpllLookahead lookahead(formula, 4u, 2u);
+
+    ASSERT_NE(lookahead.request(dpll_formula), 0);
+    ASSERT_NE(lookahead.request(dpll_formula), 0);
+    ASSERT_EQ(lookahead.budget(), 0u);
+    ASSERT_EQ(lookahead.request(dpll_formula), 0);
+
+    // the next formula gets the whole budget again
+    lookahead.reset(formula);
+    ASSERT_EQ(lookahead.budget(), 2u);
+    ASSERT_NE(lookahead.request(dpll_formula), 0);
+}
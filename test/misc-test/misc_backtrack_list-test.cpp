@@ -1,7 +1,10 @@
 #include <vector>
 
 #include "misc/CBacktrackSkiplist.hpp"
+#include "misc/CBacktrackCompactSkiplist.hpp"
 #include "misc/CBacktrackList.hpp"
+#include "misc/CBacktrackArenaList.hpp"
+#include "misc/CBacktrackInlineArray.hpp"
 
 #include "gtest/gtest.h"
 
@@ -25,6 +28,38 @@ TEST(MiscBacktrackTest, list)
     ASSERT_EQ(bl.size(), 4);
 }
 
+TEST(MiscBacktrackTest, arena_list)
+{
+    std::vector vec = { 1, 2, 3};
+    CBacktrackArenaList<int> bl(std::begin(vec), std::end(vec));
+
+    auto bl_it = ++std::begin(bl);
+    ASSERT_EQ(*bl_it, 2);
+
+    auto bl_node = bl.extract(bl_it);
+    ASSERT_EQ(bl_node.get(), 2);
+    ASSERT_EQ(*++std::begin(bl), 3);
+
+    // nodes refer to indices, so reallocation keeps them valid
+    for (int val = 4; val < 100; ++val)
+        bl.push_back(val);
+
+    auto front_node = bl.extract(std::begin(bl));
+    auto back_node = bl.extract(--std::end(bl));
+    ASSERT_EQ(bl.size(), 96);
+
+    bl.restore(std::move(back_node));
+    bl.restore(std::move(front_node));
+    bl.restore(std::move(bl_node));
+    ASSERT_EQ(bl.size(), 99);
+
+    int expected = 1;
+    for (int val : bl)
+        ASSERT_EQ(val, expected++);
+
+    ASSERT_EQ(*--std::end(bl), 99);
+}
+
 TEST(MiscBacktrackTest, skiplist)
 {
     std::vector vec = { 1, 2, 3};
@@ -40,3 +75,75 @@ TEST(MiscBacktrackTest, skiplist)
     bsl.restore(std::move(bsl_node));
     ASSERT_EQ(bsl.size(), 3);
 }
+
+TEST(MiscBacktrackTest, compact_skiplist)
+{
+    std::vector<int> vec;
+    for (int val = 100; val > 0; --val)
+        vec.push_back(val);
+
+    CBacktrackCompactSkiplist bsl(std::move(vec));
+    ASSERT_TRUE(bsl.ok());
+    ASSERT_EQ(bsl.find(0), std::end(bsl));
+    ASSERT_EQ(bsl.find(101), std::end(bsl));
+
+    auto bsl_node = bsl.extract(bsl.find(50));
+    ASSERT_EQ(bsl_node.get(), 50);
+    ASSERT_EQ(bsl.find(50), std::end(bsl));
+
+    auto front_node = bsl.extract(std::begin(bsl));
+    auto back_node = bsl.extract(--std::end(bsl));
+    ASSERT_EQ(bsl.size(), 97);
+    ASSERT_EQ(*bsl.find(99), 99);
+    ASSERT_EQ(bsl.find(100), std::end(bsl));
+
+    bsl.restore(std::move(back_node));
+    bsl.restore(std::move(front_node));
+    bsl.restore(std::move(bsl_node));
+    ASSERT_EQ(bsl.size(), 100);
+
+    int expected = 1;
+    for (int val : bsl)
+    {
+        ASSERT_EQ(val, expected);
+        ASSERT_EQ(*bsl.find(expected++), val);
+    }
+}
+
+TEST(MiscBacktrackTest, inline_array)
+{
+    std::vector vec = { 1, 2, 3, 4, 5 };
+    CBacktrackInlineArray<int> bia(vec);
+    ASSERT_TRUE(bia.ok());
+    ASSERT_TRUE(bia.is_inline());
+
+    auto bia_node = bia.extract(bia.find(2));
+    ASSERT_EQ(bia_node.get(), 2);
+    ASSERT_EQ(bia.find(2), std::end(bia));
+
+    // extracted element stays in the storage past the active ones
+    auto back_node = bia.extract(--std::end(bia));
+    ASSERT_EQ(bia.size(), 3);
+    ASSERT_EQ(bia.find(2), std::end(bia));
+    ASSERT_NE(bia.find(3), std::end(bia));
+
+    bia.restore(std::move(back_node));
+    bia.restore(std::move(bia_node));
+    ASSERT_EQ(std::vector<int>(std::begin(bia), std::end(bia)), vec);
+
+    std::vector<int> long_vec;
+    for (int val = 1; val <= 20; ++val)
+        long_vec.push_back(val);
+
+    CBacktrackInlineArray<int> heap_bia(long_vec);
+    ASSERT_TRUE(heap_bia.ok());
+    ASSERT_FALSE(heap_bia.is_inline());
+
+    auto heap_node = heap_bia.extract(heap_bia.find(10));
+    ASSERT_EQ(heap_bia.find(10), std::end(heap_bia));
+    ASSERT_EQ(*heap_bia.find(20), 20);
+
+    heap_bia.restore(std::move(heap_node));
+    ASSERT_EQ(std::vector<int>(std::begin(heap_bia), std::end(heap_bia)),
+              long_vec);
+}
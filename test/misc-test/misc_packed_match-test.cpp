@@ -0,0 +1,73 @@
+#include <random>
+#include <vector>
+
+#include "SFormula.hpp"
+#include "SPackedMatch.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(MiscPackedMatchTest, convert)
+{
+    std::mt19937 gen(2020u);
+
+    // sizes around the word's boundary
+    for (size_t params_cnt : { 0u, 1u, 63u, 64u, 65u, 200u })
+    {
+        SMatch match = { 
+            .value_vec = std::vector<SMatch::EValue>(params_cnt) 
+        };
+
+        for (auto& value : match.value_vec)
+            value = static_cast<SMatch::EValue>(gen() % 3u);
+
+        SPackedMatch packed = pack(match);
+        ASSERT_EQ(packed.value_vec.size(), 
+                  SPackedMatch::words_cnt(params_cnt));
+        ASSERT_EQ(unpack(packed), match);
+
+        for (size_t param = 0u; param < params_cnt; ++param)
+            ASSERT_EQ(packed.get(param), match.value_vec[param]);
+
+        if (params_cnt == 0u)
+            continue;
+
+        // flipped value breaks the equality, restored one brings it back
+        SPackedMatch other = packed;
+        auto value = other.get(params_cnt - 1u);
+        other.set(params_cnt - 1u, value == SMatch::EValue::TRUE ?
+                                   SMatch::EValue::NONE : 
+                                   SMatch::EValue::TRUE);
+        ASSERT_NE(other, packed);
+
+        other.set(params_cnt - 1u, value);
+        ASSERT_EQ(other, packed);
+    }
+}
+
+TEST(MiscPackedMatchTest, is_match)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 500u; ++test)
+    {
+        size_t params_cnt = 1u + gen() % 130u;
+        auto formula = random_formula(gen, params_cnt, 1u + gen() % 8u, 1u, 4u);
+
+        SMatch match = { 
+            .value_vec = std::vector<SMatch::EValue>(formula.params_cnt) 
+        };
+
+        // mostly assigned params to get both outcomes
+        for (auto& value : match.value_vec)
+            value = static_cast<SMatch::EValue>(gen() % 7u == 0u ? 2u : 
+                                                gen() % 2u);
+
+        ASSERT_EQ(formula.is_match(pack(match)), formula.is_match(match))
+            << formula << match;
+    }
+}
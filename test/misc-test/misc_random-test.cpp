@@ -0,0 +1,55 @@
+#include <thread>
+#include <vector>
+
+#include "CRandom.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+
+TEST(MiscRandomTest, streams)
+{
+    CRandom gen(2020u), same_gen(2020u), other_gen(2020u, 1u);
+
+    for (size_t iter = 0u; iter < 100u; ++iter)
+    {
+        const auto word = gen();
+        ASSERT_EQ(word, same_gen());
+        ASSERT_NE(word, other_gen());
+    }
+
+    size_t total = 0u;
+    for (size_t iter = 0u; iter < 10000u; ++iter)
+    {
+        const size_t value = gen.geometric(8u);
+        ASSERT_GE(value, 1u);
+        ASSERT_LE(value, 8u);
+        total += value;
+
+        ASSERT_LT(gen.below(7u), 7u);
+        ASSERT_LT(gen.unit(), 1.0);
+    }
+
+    // expectation of the truncated geometric distribution is 2 - 2^-7
+    ASSERT_NEAR(static_cast<double>(total)/10000.0, 2.0, 0.1);
+}
+
+TEST(MiscRandomTest, local)
+{
+    std::vector<uint64_t> word_vec;
+
+    CRandom::set_seed(2021u);
+    for (size_t iter = 0u; iter < 10u; ++iter)
+        word_vec.push_back(CRandom::local()());
+
+    // the other thread gets the next stream
+    uint64_t thread_word = 0u;
+    std::thread([&thread_word] { thread_word = CRandom::local()(); }).join();
+    ASSERT_EQ(thread_word, CRandom(2021u, 1u)());
+
+    CRandom::set_seed(2021u);
+    for (size_t iter = 0u; iter < 10u; ++iter)
+        ASSERT_EQ(CRandom::local()(), word_vec[iter]);
+
+    CRandom::set_seed(CRandom::DEFAULT_SEED);
+}
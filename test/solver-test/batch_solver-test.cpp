@@ -0,0 +1,91 @@
+#include <thread>
+#include <vector>
+
+#include "CBatchSolver.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+
+TEST(BatchSolverTest, solve)
+{
+    std::vector<SFormula> formula_vec;
+    for (int32_t idx = 0; idx < 100; ++idx)
+    {
+        formula_vec.push_back(SFormula {
+            .params_cnt = 3u,
+            .clause_vec = {
+                { 1, -2 },
+                { 2, -3 },
+                { 3, -1 },
+                { (idx % 2 == 0 ? 1 : -1) },
+            }
+        });
+    }
+
+    // unsatisfiable formula
+    formula_vec.push_back(SFormula {
+        .params_cnt = 1u,
+        .clause_vec = { { 1 }, { -1 } }
+    });
+
+    CBatchSolver solver(4u);
+    auto result_vec = solver.solve(formula_vec);
+    ASSERT_EQ(result_vec.size(), formula_vec.size());
+
+    for (size_t idx = 0u; idx + 1u < formula_vec.size(); ++idx)
+    {
+        ASSERT_TRUE(result_vec[idx].has_value());
+        ASSERT_TRUE(formula_vec[idx].is_match(*result_vec[idx]));
+        ASSERT_EQ(result_vec[idx]->value_vec[0u], 
+                  (idx % 2 == 0 ? SMatch::EValue::TRUE : 
+                                  SMatch::EValue::FALSE));
+    }
+
+    ASSERT_FALSE(result_vec.back().has_value());
+
+    // pool and contexts are reused by the next batch
+    auto again_vec = solver.solve(formula_vec);
+    ASSERT_EQ(again_vec.size(), result_vec.size());
+    ASSERT_FALSE(again_vec.back().has_value());
+}
+
+TEST(BatchSolverTest, concurrent)
+{
+    std::vector<SFormula> formula_vec;
+    for (int32_t idx = 0; idx < 100; ++idx)
+    {
+        formula_vec.push_back(SFormula {
+            .params_cnt = 2u,
+            .clause_vec = {
+                { 1, 2 },
+                { (idx % 2 == 0 ? 1 : -1), -2 },
+            }
+        });
+    }
+
+    // batches from different threads share the pool one at a time
+    CBatchSolver solver(4u);
+    std::vector<std::vector<CBatchSolver::result_t>> result_vecs(4u);
+    {
+        std::vector<std::jthread> thread_vec;
+        for (auto& result_vec : result_vecs)
+        {
+            thread_vec.emplace_back([&solver, &formula_vec, &result_vec]
+            {
+                for (size_t round = 0u; round < 10u; ++round)
+                    result_vec = solver.solve(formula_vec);
+            });
+        }
+    }
+
+    for (const auto& result_vec : result_vecs)
+    {
+        ASSERT_EQ(result_vec.size(), formula_vec.size());
+        for (size_t idx = 0u; idx < formula_vec.size(); ++idx)
+        {
+            ASSERT_TRUE(result_vec[idx].has_value());
+            ASSERT_TRUE(formula_vec[idx].is_match(*result_vec[idx]));
+        }
+    }
+}
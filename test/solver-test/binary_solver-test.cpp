@@ -0,0 +1,113 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "CBinarySolver.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(BinarySolverTest, proceed)
+{
+    SFormula formula = {
+        .params_cnt = 4u,
+        .clause_vec = {
+            { 1, -2 },
+            { 2, -3 },
+            { 3, -1 },
+            { -1, 4 },
+            { -4 },
+        }
+    };
+
+    auto solver = CBinarySolver(formula);
+    auto it = solver.begin();
+
+    ASSERT_NE(it, solver.end());
+    ASSERT_TRUE(formula.is_match(*it));
+}
+
+TEST(BinarySolverTest, random)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 200u; ++test)
+    {
+        size_t params_cnt = 1u + gen() % 8u;
+        auto formula = random_formula(gen, params_cnt, gen() % 16u, 1u, 2u);
+        bool satisfiable = !brute_force(formula).empty();
+
+        auto solver = CBinarySolver(formula);
+        auto it = solver.begin();
+
+        ASSERT_EQ(it != solver.end(), satisfiable) << formula;
+        if (satisfiable)
+        {
+            ASSERT_TRUE(formula.is_match(*it)) << formula;
+        }
+    }
+}
+
+TEST(BinarySolverTest, enumerate)
+{
+    std::mt19937 gen(2021u);
+
+    for (size_t test = 0u; test < 200u; ++test)
+    {
+        size_t params_cnt = 1u + gen() % 8u;
+        auto formula = random_formula(gen, params_cnt, gen() % 12u, 1u, 2u);
+
+        std::set<std::vector<SMatch::EValue>> expected_set;
+        for (const auto& match : brute_force(formula))
+            expected_set.insert(match.value_vec);
+
+        std::set<std::vector<SMatch::EValue>> actual_set;
+        size_t match_cnt = 0u;
+
+        auto solver = CBinarySolver(formula);
+        for (const auto& cur_match : solver)
+        {
+            ASSERT_TRUE(formula.is_match(cur_match)) << formula;
+            actual_set.insert(cur_match.value_vec);
+            ++match_cnt;
+        }
+
+        ASSERT_EQ(match_cnt, actual_set.size()) << formula;
+        ASSERT_EQ(actual_set, expected_set) << formula;
+    }
+}
+
+TEST(BinarySolverTest, add_clause)
+{
+    std::mt19937 gen(2022u);
+
+    for (size_t test = 0u; test < 100u; ++test)
+    {
+        SFormula formula = { .params_cnt = 1u + gen() % 8u, .clause_vec = {} };
+        auto solver = CBinarySolver(formula);
+
+        for (size_t cls = 0u; cls < 24u; ++cls)
+        {
+            auto clause = random_clause(gen, formula.params_cnt, 
+                                        1u + gen() % 2u);
+            formula.clause_vec.push_back(clause);
+
+            std::set<std::vector<SMatch::EValue>> expected_set;
+            for (const auto& match : brute_force(formula))
+                expected_set.insert(match.value_vec);
+
+            ASSERT_EQ(solver.add_clause(clause), !expected_set.empty()) 
+                << formula;
+
+            std::set<std::vector<SMatch::EValue>> actual_set;
+            for (const auto& cur_match : solver)
+                actual_set.insert(cur_match.value_vec);
+
+            ASSERT_EQ(actual_set, expected_set) << formula;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include <random>
+#include <vector>
+
+#include "CCountSolver.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(CountSolverTest, big_uint)
+{
+    ASSERT_EQ(CBigUint().to_string(), "0");
+    ASSERT_EQ(CBigUint(1'000'000'000u).to_string(), "1000000000");
+    ASSERT_EQ((CBigUint(1u) << 100u).to_string(),
+              "1267650600228229401496703205376");
+
+    CBigUint power = 1u;
+    for (size_t idx = 0u; idx < 40u; ++idx)
+        power *= 3u;
+
+    ASSERT_EQ(power.to_string(), "12157665459056928801");
+    ASSERT_EQ((power + power + power).to_string(), "36472996377170786403");
+    ASSERT_EQ((CBigUint(1u) << 100u).bit_width(), 101u);
+}
+
+TEST(CountSolverTest, random)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 300u; ++test)
+    {
+        // empty clauses are allowed
+        size_t params_cnt = 1u + gen() % 10u;
+        auto formula = random_formula(gen, params_cnt, gen() % 20u, 0u, 3u);
+        uint64_t expected = brute_force(formula).size();
+
+        // small cache limit checks the clearing
+        CCountSolver solver(formula, test % 2u ? 4u : 
+                            CCountSolver::DEFAULT_CACHE_LIMIT);
+        ASSERT_EQ(solver.count(), CBigUint(expected));
+        ASSERT_EQ(solver.count(), CBigUint(expected));
+    }
+}
+
+TEST(CountSolverTest, large)
+{
+    // 50 independent (x v y) blocks and 100 free params
+    SFormula formula = { .params_cnt = 200u, .clause_vec = {} };
+    for (int32_t param = 1; param <= 100; param += 2)
+        formula.clause_vec.push_back({ param, param + 1 });
+
+    CBigUint expected = CBigUint(1u) << 100u;
+    for (size_t idx = 0u; idx < 50u; ++idx)
+        expected *= 3u;
+
+    CCountSolver solver(formula);
+    ASSERT_EQ(solver.count(), expected);
+
+    // implication chain x_1 -> ... -> x_n has n + 1 models
+    SFormula chain = { .params_cnt = 1000u, .clause_vec = {} };
+    for (int32_t param = 1; param < 1000; ++param)
+        chain.clause_vec.push_back({ -param, param + 1 });
+
+    CCountSolver chain_solver(chain);
+    ASSERT_EQ(chain_solver.count(), CBigUint(1001u));
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "CDispatchSolver.hpp"
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+
+using namespace tinysat;
+
+TEST(DispatchSolverTest, choose)
+{
+    using EEngine = CDispatchSolver::EEngine;
+
+    // logger without sinks keeps the test output clean
+    auto logger = std::make_shared<spdlog::logger>("dispatch");
+
+    std::vector<std::pair<SFormula, EEngine>> case_vec = {
+        { { .params_cnt = 3u, .clause_vec = { { 1, 2 }, { -2, 3 }, {} } },
+          EEngine::UNSAT },
+        { { .params_cnt = 3u, .clause_vec = { { 1, 2 }, { -2, 3 }, { -1 } } },
+          EEngine::BINARY },
+        { { .params_cnt = 3u, .clause_vec = { { 1, -2, -3 }, { 2 }, { 3 } } },
+          EEngine::HORN },
+        { { .params_cnt = 3u, .clause_vec = { { 1, 2, 3 }, { -1, -2 } } },
+          EEngine::GENERAL },
+    };
+
+    SFormula wide = { .params_cnt = 40u, .clause_vec = {} };
+    for (int32_t param = 1; param + 2 <= 40; ++param)
+        wide.clause_vec.push_back({ param, param + 1, -(param + 2) });
+
+    case_vec.emplace_back(wide, EEngine::DPLL);
+
+    for (const auto& [formula, engine] : case_vec)
+    {
+        auto solver = CDispatchSolver(formula, logger);
+        ASSERT_EQ(solver.stats().engine, engine) << formula;
+
+        auto it = solver.begin();
+        if (engine == EEngine::UNSAT)
+        {
+            ASSERT_EQ(it, solver.end());
+            continue;
+        }
+
+        ASSERT_NE(it, solver.end()) << formula;
+        ASSERT_TRUE(formula.is_match(*it)) << formula;
+    }
+}
+
+TEST(DispatchSolverTest, enumerate)
+{
+    auto logger = std::make_shared<spdlog::logger>("dispatch");
+
+    SFormula formula = {
+        .params_cnt = 3u,
+        .clause_vec = { { 1, 2, 3 }, { -1, -2 }, { -2, -3 } }
+    };
+
+    auto solver = CDispatchSolver(formula, logger);
+    ASSERT_EQ(solver.stats().max_clause_size, 3u);
+    ASSERT_EQ(solver.stats().lit_cnt, 7u);
+
+    // 1 0 0, 0 1 0, 0 0 1, 1 0 1
+    size_t match_cnt = 0u;
+    for (const auto& match : solver)
+    {
+        ASSERT_TRUE(formula.is_match(match));
+        ++match_cnt;
+    }
+
+    ASSERT_EQ(match_cnt, 4u);
+}
+
+TEST(DispatchSolverTest, horn_enumerate)
+{
+    auto logger = std::make_shared<spdlog::logger>("dispatch");
+
+    SFormula formula = {
+        .params_cnt = 5u,
+        .clause_vec = { { 1, -2, -3 }, { -1, -4, 5 }, { -5, -2, -4 } }
+    };
+
+    auto solver = CDispatchSolver(formula, logger);
+    ASSERT_EQ(solver.stats().engine, CDispatchSolver::EEngine::HORN);
+
+    std::vector<SMatch> match_vec;
+    for (const auto& match : solver)
+    {
+        ASSERT_TRUE(formula.is_match(match));
+        ASSERT_EQ(std::count(std::begin(match_vec), std::end(match_vec), 
+                             match), 0);
+        match_vec.push_back(match);
+    }
+
+    // the minimal model goes first, the rest ones are the same as DPLL's
+    size_t dpll_cnt = 0u;
+    for ([[maybe_unused]] const auto& match : CDpllSolver(formula, logger))
+        ++dpll_cnt;
+
+    ASSERT_GT(match_vec.size(), 1u);
+    ASSERT_EQ(match_vec.size(), dpll_cnt);
+    ASSERT_EQ(match_vec.front(), *CHornSolver(formula).begin());
+}
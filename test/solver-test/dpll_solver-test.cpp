@@ -1,4 +1,5 @@
 #include <iostream>
+#include <vector>
 
 #include "CDpllSolver.hpp"
 
@@ -27,3 +28,75 @@ TEST(DpllSolverTest, proceed)
     ASSERT_NE(it, end);
     ASSERT_TRUE(formula.is_match(*it));
 }
+
+TEST(DpllSolverTest, async)
+{
+    SFormula formula = {
+        .params_cnt = 9u,
+        .clause_vec = {
+            { -1, 2, 5 },
+            { 1, 3 },
+            { 2, 5, -8 },
+            { -3, 4, -5 },
+            { 7, -9 },
+            { -6, 8 },
+        }
+    };
+
+    auto logger = spdlog::get("async");
+    if (logger == nullptr)
+        logger = spdlog::stdout_color_mt("async");
+
+    auto solver = CDpllSolver(formula, logger);
+
+    std::vector<SMatch> expected_vec;
+    for (const auto& model : solver)
+        expected_vec.push_back(model);
+
+    std::vector<SMatch> generated_vec;
+    for (const SMatch& model : solver.models())
+        generated_vec.push_back(model);
+
+    ASSERT_EQ(generated_vec, expected_vec);
+
+    auto future = solver.solve_async();
+    auto model = future.get();
+    ASSERT_TRUE(model.has_value());
+    ASSERT_EQ(*model, expected_vec.front());
+
+    // raised flag interrupts the search before the first solution
+    auto stop_flag = std::make_shared<std::atomic<bool>>(true);
+    ASSERT_FALSE(solver.solve_async(stop_flag).get().has_value());
+
+    // tiny capacity makes the producer wait for the consumer
+    auto stream = solver.stream(2u);
+
+    std::vector<SMatch> result_vec;
+    while (auto next = stream->pop())
+        result_vec.push_back(std::move(*next));
+
+    ASSERT_TRUE(stream->done());
+    ASSERT_FALSE(stream->try_pop().has_value());
+    ASSERT_EQ(result_vec, expected_vec);
+
+    // stream closed in the middle keeps the buffered solutions
+    auto closed = solver.stream(1u);
+    ASSERT_TRUE(closed->pop().has_value());
+    closed->close();
+
+    size_t rest_cnt = 0u;
+    while (closed->pop())
+        ++rest_cnt;
+
+    ASSERT_LE(rest_cnt, 1u);
+    ASSERT_TRUE(closed->done());
+
+    SFormula unsat_formula = {
+        .params_cnt = 1u,
+        .clause_vec = { { 1 }, { -1 } }
+    };
+
+    auto unsat_solver = CDpllSolver(unsat_formula, logger);
+    ASSERT_FALSE(unsat_solver.solve_async().get().has_value());
+    ASSERT_FALSE(unsat_solver.stream()->pop().has_value());
+}
@@ -0,0 +1,209 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "CGeneralSolver.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(GeneralSolverTest, proceed)
+{
+    SFormula formula = {
+        .params_cnt = 9u,
+        .clause_vec = {
+            { -1, 2, 5 },
+            { 1, 3 },
+            { 2, 5, -8 },
+            { -3, 4, -5 },
+            { 7, -9 },
+            { -6, 8 },
+        }
+    };
+
+    // brute force goes in the same order
+    std::vector<SMatch> expected_vec = brute_force(formula);
+
+    auto solver = CGeneralSolver(formula);
+
+    std::vector<SMatch> result_vec;
+    for (const auto& model : solver)
+        result_vec.push_back(model);
+
+    ASSERT_EQ(result_vec, expected_vec);
+}
+
+TEST(GeneralSolverTest, small)
+{
+    SFormula formula = {
+        .params_cnt = 2u,
+        .clause_vec = { { 1, 2 }, { -1 } }
+    };
+
+    auto solver = CGeneralSolver(formula);
+    auto it = solver.begin();
+
+    ASSERT_NE(it, solver.end());
+    ASSERT_EQ(*it, (SMatch { { SMatch::EValue::FALSE, SMatch::EValue::TRUE } }));
+    ASSERT_EQ(++it, solver.end());
+}
+
+TEST(GeneralSolverTest, parallel)
+{
+    SFormula formula = {
+        .params_cnt = 21u,
+        .clause_vec = {
+            { -1, 2, 9 },
+            { 17, -18, 19 },
+            { -20, 21 },
+            { 18, 20, -21 },
+            { 1, 3, -12 },
+            { 2, 5, -8 },
+            { -3, 14, -5 },
+            { 7, -9, 16 },
+            { -6, 8, 15 },
+            { -10, -11 },
+            { 13, -16 },
+        }
+    };
+
+    auto sequential_solver = CGeneralSolver(formula);
+    auto parallel_solver = CGeneralSolver(formula, 
+                                          std::make_shared<CThreadPool>(4u));
+
+    std::vector<SMatch> sequential_vec, parallel_vec;
+    for (const auto& model : sequential_solver)
+        sequential_vec.push_back(model);
+
+    for (const auto& model : parallel_solver)
+        parallel_vec.push_back(model);
+
+    ASSERT_FALSE(sequential_vec.empty());
+    ASSERT_EQ(parallel_vec, sequential_vec);
+}
+
+TEST(GeneralSolverTest, limits)
+{
+    SFormula formula = {
+        .params_cnt = 12u,
+        .clause_vec = {
+            { -1, 2, 9 },
+            { 1, 3, -12 },
+            { 2, 5, -8 },
+            { -3, 4, -5 },
+            { 7, -9, 11 },
+            { -6, 8 },
+            { -10, -11 },
+        }
+    };
+
+    for (auto thread_pool : { std::shared_ptr<CThreadPool>(), 
+                              std::make_shared<CThreadPool>(2u) })
+    {
+        auto solver = CGeneralSolver(formula, thread_pool);
+
+        std::vector<SMatch> expected_vec;
+        for (const auto& model : solver)
+            expected_vec.push_back(model);
+
+        // search is interrupted after every single block and resumed
+        CLimits limits;
+        limits.set_propagation_budget(1u);
+        solver.set_limits(limits);
+
+        std::vector<SMatch> result_vec;
+        size_t unknown_cnt = 0u;
+
+        auto context = solver.context();
+        while (context)
+        {
+            if (context->status() == EStatus::SAT)
+                result_vec.push_back(context->match());
+            else
+                ++unknown_cnt;
+
+            context->limits().set_propagation_budget(1u);
+            solver.resume(context);
+        }
+
+        ASSERT_FALSE(expected_vec.empty());
+        ASSERT_EQ(result_vec, expected_vec);
+        ASSERT_GT(unknown_cnt, 0u);
+    }
+}
+
+TEST(GeneralSolverTest, limited_iteration)
+{
+    // UNSAT, but refuted only after all the blocks are checked
+    SFormula formula = { .params_cnt = 24u };
+    for (int param = 1; param <= 24; ++param)
+        formula.clause_vec.push_back({ param });
+    formula.clause_vec.push_back({ -1, -2 });
+
+    for (auto thread_pool : { std::shared_ptr<CThreadPool>(), 
+                              std::make_shared<CThreadPool>(2u) })
+    {
+        auto solver = CGeneralSolver(formula, thread_pool);
+
+        CLimits limits;
+        limits.set_propagation_budget(1000u);
+        solver.set_limits(limits);
+
+        // interrupted iteration ends instead of yielding the candidates
+        size_t model_cnt = 0u;
+        for (auto it = std::begin(solver); 
+             it != std::end(solver) && model_cnt < 5u; ++it)
+        {
+            ASSERT_TRUE(formula.is_match(*it));
+            ++model_cnt;
+        }
+
+        ASSERT_EQ(model_cnt, 0u);
+
+        // while the explicit resumption reports it
+        auto context = solver.context();
+        ASSERT_NE(context, nullptr);
+        ASSERT_EQ(context->status(), EStatus::UNKNOWN);
+
+        context->limits().set_propagation_budget(1000u);
+        ASSERT_EQ(solver.resume(context), EStatus::UNKNOWN);
+        ASSERT_NE(context, nullptr);
+
+        context->limits().set_propagation_budget(CLimits::UNLIMITED);
+        ASSERT_EQ(solver.resume(context), EStatus::UNSAT);
+        ASSERT_EQ(context, nullptr);
+    }
+}
+
+TEST(GeneralSolverTest, watch)
+{
+    std::mt19937 gen(2020u);
+
+    // wider formulas span several tasks and windows of the single worker
+    for (size_t test = 0u; test < 42u; ++test)
+    {
+        size_t params_cnt = (test < 40u ? 7u + gen() % 7u : 19u);
+        auto formula = random_formula(gen, params_cnt, 2u*params_cnt,
+                                      2u, 4u, true);
+
+        // brute force goes in the same order
+        auto expected_vec = brute_force(formula);
+
+        for (auto thread_pool : { std::shared_ptr<CThreadPool>(),
+                                  std::make_shared<CThreadPool>(1u),
+                                  std::make_shared<CThreadPool>(2u) })
+        {
+            auto solver = CGeneralSolver(formula, thread_pool);
+
+            std::vector<SMatch> result_vec;
+            for (const auto& model : solver)
+                result_vec.push_back(model);
+
+            ASSERT_EQ(result_vec, expected_vec);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <random>
+#include <vector>
+
+#include "CHornSolver.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(HornSolverTest, detect)
+{
+    SFormula horn = {
+        .params_cnt = 3u,
+        .clause_vec = { { 1, -2, -3 }, { -1 }, { 2 } }
+    };
+
+    SFormula renamable = {
+        .params_cnt = 3u,
+        .clause_vec = { { 1, 2, -3 }, { -1, 3 } }
+    };
+
+    SFormula general = {
+        .params_cnt = 3u,
+        .clause_vec = { { 1, 2, 3 }, { -1, -2, -3 } }
+    };
+
+    ASSERT_EQ(CHornSolver::detect(horn), CHornSolver::EHornKind::HORN);
+    ASSERT_EQ(CHornSolver::detect(renamable), 
+              CHornSolver::EHornKind::RENAMABLE);
+    ASSERT_EQ(CHornSolver::detect(general), CHornSolver::EHornKind::NONE);
+
+    ASSERT_THROW(CHornSolver{ general }, CException);
+
+    // given renaming is checked
+    ASSERT_THROW((CHornSolver{ renamable, std::vector<bool>(3u, false) }), 
+                 CException);
+    ASSERT_THROW((CHornSolver{ renamable, std::vector<bool>(2u, true) }), 
+                 CException);
+}
+
+TEST(HornSolverTest, random)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 300u; ++test)
+    {
+        SFormula formula = { .params_cnt = 1u + gen() % 8u, .clause_vec = {} };
+
+        size_t clause_cnt = gen() % 16u;
+        for (size_t cls = 0u; cls < clause_cnt; ++cls)
+        {
+            std::vector<int32_t> clause;
+            for (size_t lit = 0u; lit < gen() % 4u; ++lit)
+            {
+                int32_t param = 1 + static_cast<int32_t>(
+                    gen() % formula.params_cnt);
+                clause.push_back(lit == 0u && gen() % 2u ? param : -param);
+            }
+
+            formula.clause_vec.push_back(std::move(clause));
+        }
+
+        // half of the formulas are renamed to check the renamable case
+        std::vector<bool> flip_vec(formula.params_cnt, false);
+        if (test % 2u)
+        {
+            for (size_t param = 0u; param < formula.params_cnt; ++param)
+                flip_vec[param] = gen() % 2u;
+
+            for (auto& clause : formula.clause_vec)
+            {
+                for (auto& literal : clause)
+                    literal = (flip_vec[std::abs(literal) - 1] ? 
+                               -literal : literal);
+            }
+        }
+
+        // renaming is found once and passed to the solver
+        auto renaming = CHornSolver::find_renaming(formula);
+        ASSERT_TRUE(renaming.has_value()) << formula;
+
+        std::vector<SMatch> match_vec = brute_force(formula);
+
+        // Horn formula is solved as is to get the minimal model
+        bool reuse = (test % 4u == 3u && !CHornSolver::is_horn(formula));
+        auto solver = (reuse ? CHornSolver(formula, std::move(*renaming)) :
+                               CHornSolver(formula));
+        auto it = solver.begin();
+
+        ASSERT_EQ(it != solver.end(), !match_vec.empty()) << formula;
+        if (it == solver.end())
+            continue;
+
+        SMatch result = *it;
+        ASSERT_TRUE(formula.is_match(result)) << formula;
+
+        // minimal model of the Horn formula is below every model
+        if (CHornSolver::is_horn(formula))
+        {
+            for (const auto& cur_match : match_vec)
+            {
+                for (size_t param = 0u; param < formula.params_cnt; ++param)
+                {
+                    ASSERT_FALSE(
+                        result.value_vec[param] == SMatch::EValue::TRUE &&
+                        cur_match.value_vec[param] == SMatch::EValue::FALSE)
+                        << formula;
+                }
+            }
+        }
+
+        ASSERT_EQ(++it, solver.end());
+    }
+}
@@ -0,0 +1,79 @@
+#include <random>
+#include <vector>
+
+#include "CLocalSolver.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+
+namespace {
+
+// random 3-SAT with the planted model, so it is satisfiable
+SFormula planted_formula(std::mt19937& gen, size_t params_cnt, 
+                         size_t clause_cnt)
+{
+    std::vector<bool> planted_vec(params_cnt);
+    for (size_t param = 0u; param < params_cnt; ++param)
+        planted_vec[param] = gen() % 2u;
+
+    SFormula formula = { .params_cnt = params_cnt, .clause_vec = {} };
+    while (formula.clause_vec.size() < clause_cnt)
+    {
+        std::vector<int32_t> clause;
+        bool satisfied = false;
+        for (size_t lit = 0u; lit < 3u; ++lit)
+        {
+            size_t param = gen() % params_cnt;
+            bool positive = gen() % 2u;
+
+            satisfied = satisfied || (positive == planted_vec[param]);
+            clause.push_back(positive ? static_cast<int32_t>(param + 1u) :
+                                        -static_cast<int32_t>(param + 1u));
+        }
+
+        if (satisfied)
+            formula.clause_vec.push_back(std::move(clause));
+    }
+
+    return formula;
+}
+
+} // namespace
+
+TEST(LocalSolverTest, policies)
+{
+    std::mt19937 gen(2020u);
+
+    for (auto policy : { ELocalPolicy::PROBSAT, ELocalPolicy::WALKSAT })
+    {
+        for (size_t test = 0u; test < 20u; ++test)
+        {
+            auto formula = planted_formula(gen, 100u, 400u);
+            auto solver = CLocalSolver(formula, { .policy = policy, 
+                                                  .seed = test });
+
+            size_t match_cnt = 0u;
+            for (auto it = solver.begin(); 
+                 it != solver.end() && match_cnt < 5u; ++it, ++match_cnt)
+                ASSERT_TRUE(formula.is_match(*it)) << formula;
+
+            ASSERT_EQ(match_cnt, 5u) << formula;
+        }
+    }
+}
+
+TEST(LocalSolverTest, budget)
+{
+    SFormula formula = {
+        .params_cnt = 2u,
+        .clause_vec = { { 1, 2 }, { -1, 2 }, { 1, -2 }, { -1, -2 } }
+    };
+
+    auto solver = CLocalSolver(formula, { .max_flips = 1000u });
+    ASSERT_EQ(solver.begin(), solver.end());
+
+    formula.clause_vec = { { 1, 1, -1 }, {} };
+    auto empty_solver = CLocalSolver(formula);
+    ASSERT_EQ(empty_solver.begin(), empty_solver.end());
+}
@@ -0,0 +1,106 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "CXorSolver.hpp"
+
+#include "common/random_formula.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace tinysat;
+using namespace tinysat::test;
+
+TEST(XorSolverTest, enumerate)
+{
+    std::mt19937 gen(2020u);
+
+    for (size_t test = 0u; test < 200u; ++test)
+    {
+        size_t params_cnt = 1u + gen() % 8u;
+        auto formula = random_formula<SXorFormula>(gen, params_cnt, 
+                                                   gen() % 10u, 1u, 4u);
+
+        std::set<std::vector<SMatch::EValue>> expected_set;
+        for (const auto& match : brute_force(formula))
+            expected_set.insert(match.value_vec);
+
+        std::set<std::vector<SMatch::EValue>> actual_set;
+        size_t match_cnt = 0u;
+
+        auto solver = CXorSolver(formula);
+        for (const auto& cur_match : solver)
+        {
+            ASSERT_TRUE(formula.is_match(cur_match)) << formula;
+            actual_set.insert(cur_match.value_vec);
+            ++match_cnt;
+        }
+
+        ASSERT_EQ(match_cnt, actual_set.size()) << formula;
+        ASSERT_EQ(actual_set, expected_set) << formula;
+    }
+}
+
+TEST(XorSolverTest, extract)
+{
+    SFormula formula = {
+        .params_cnt = 3u,
+        .clause_vec = {
+            // x1 ^ x2 ^ x3 == TRUE
+            { 1, 2, 3 }, { 1, -2, -3 }, { -1, 2, -3 }, { -1, -2, 3 },
+            // x1 ^ x2 == FALSE
+            { -1, 2 }, { 1, -2 },
+        }
+    };
+
+    auto xor_formula = CXorSolver::extract(formula);
+    ASSERT_TRUE(xor_formula.has_value());
+    ASSERT_EQ(xor_formula->clause_vec.size(), 2u);
+
+    size_t match_cnt = 0u;
+    for (const auto& match : CXorSolver(formula))
+    {
+        ASSERT_TRUE(formula.is_match(match));
+        ++match_cnt;
+    }
+
+    ASSERT_EQ(match_cnt, 2u);
+
+    formula.clause_vec.pop_back();
+    ASSERT_FALSE(CXorSolver::extract(formula).has_value());
+    ASSERT_THROW(CXorSolver{ formula }, CException);
+}
+
+TEST(XorSolverTest, large)
+{
+    std::mt19937 gen(2021u);
+
+    size_t params_cnt = 2000u;
+    auto formula = random_formula<SXorFormula>(gen, params_cnt, 1900u, 
+                                               1u, 8u);
+
+    // planted model keeps the system consistent
+    SMatch planted = { .value_vec = {} };
+    for (size_t param = 0u; param < params_cnt; ++param)
+    {
+        planted.value_vec.push_back(gen() % 2u ? SMatch::EValue::TRUE : 
+                                                 SMatch::EValue::FALSE);
+    }
+
+    for (auto& clause : formula.clause_vec)
+    {
+        SXorFormula single = { 
+            .params_cnt = params_cnt, 
+            .clause_vec = { clause } 
+        };
+        if (!single.is_match(planted))
+            clause[0u] = -clause[0u];
+    }
+
+    auto solver = CXorSolver(formula);
+    auto it = solver.begin();
+
+    ASSERT_NE(it, solver.end());
+    ASSERT_TRUE(formula.is_match(*it));
+    ASSERT_TRUE(formula.is_match(*++it));
+}